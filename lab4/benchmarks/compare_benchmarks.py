@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+# Author: Michal K.
+#
+# compares benchmark runs against the stored baseline and fails if anything got slower
+#
+#   lab4_benchmark --benchmark-out run1.json   (repeat for run2.json, run3.json)
+#   python3 compare_benchmarks.py baseline.json run1.json run2.json run3.json --threshold 0.15
+#
+# every file is written by writeBenchmarkResults() in Benchmark.cpp
+# with several runs the best value of each benchmark is compared, which hides most noise of a busy machine
+# --save-best writes that best of the runs as a new baseline, see benchmark_baseline in CMakeLists.txt
+# a benchmark regresses when it is worse than the baseline by more than the threshold, 0.15 is 15%
+# a benchmark missing from either file fails the run too, an unchecked benchmark is as bad as a slow one,
+# unless --allow-missing is given, for a machine without a path like batch_avx
+# exit code is 1 on any regression or missing benchmark, 0 otherwise, and always 0 when saving a new baseline
+
+import argparse
+import json
+import sys
+
+
+def load(path):
+    """benchmark name -> result object of a results file"""
+    with open(path) as file:
+        return {result["name"]: result for result in json.load(file)["benchmarks"]}
+
+
+def best_of(runs):
+    """benchmark name -> best result over several results files, fastest time or highest rate"""
+    best = {}
+    for run in runs:
+        for name, result in run.items():
+            if name not in best:
+                best[name] = result
+            elif result.get("higher_is_better", False) == (result["value"] > best[name]["value"]):
+                best[name] = result
+    return best
+
+
+def main():
+    parser = argparse.ArgumentParser(description="fails if a benchmark regressed against the baseline")
+    parser.add_argument("baseline", help="stored baseline, benchmarks/baseline.json, not read with --save-best")
+    parser.add_argument("results", nargs="+", help="results of the runs being checked, best of them is compared")
+    parser.add_argument("--threshold", type=float, default=0.15, help="allowed slowdown, 0.15 is 15%%")
+    parser.add_argument("--allow-missing", action="store_true", help="benchmarks missing from either file do not fail")
+    parser.add_argument("--save-best", metavar="FILE", help="write the best of the runs as a new baseline, never fails")
+    parser.add_argument("--context", default="", help="machine and build the runs were made on, kept in the saved baseline")
+    arguments = parser.parse_args()
+
+    results = best_of([load(path) for path in arguments.results])
+
+    if arguments.save_best:
+        with open(arguments.save_best, "w") as file:
+            json.dump({"context": arguments.context, "benchmarks": list(results.values())}, file, indent="\t")
+            file.write("\n")
+        print("%d benchmarks saved to %s" % (len(results), arguments.save_best))
+        return 0
+
+    baseline = load(arguments.baseline)
+    regressions = [] # names of benchmarks worse than the threshold allows
+    missing = [name for name in baseline if name not in results] # dropped, or not run on this machine
+    unbaselined = [name for name in results if name not in baseline] # never measured on the reference machine
+
+    print("%-44s %14s %14s %9s" % ("benchmark", "baseline", "current", "change"))
+
+    for name, result in results.items():
+        if name not in baseline:
+            print("%-44s %14s %14.4g %9s  not in baseline" % (name, "-", result["value"], "-"))
+            continue
+
+        old = baseline[name]["value"]
+        new = result["value"]
+        if old == 0:
+            change = 0.0 if new == 0 else float("inf")
+        else:
+            change = (new - old) / old # positive is slower for times
+
+        if result.get("higher_is_better", False): # rates, positive is faster
+            change = -change
+
+        regressed = change > arguments.threshold
+        if regressed:
+            regressions.append(name)
+
+        print("%-44s %14.4g %14.4g %+8.1f%%%s" % (name, old, new, change * 100.0, "  REGRESSED" if regressed else ""))
+
+    for name in missing:
+        print("%-44s %14.4g %14s %9s  missing" % (name, baseline[name]["value"], "-", "-"))
+
+    if regressions:
+        print("%d of %d benchmarks regressed by more than %.0f%%" % (len(regressions), len(results), arguments.threshold * 100.0))
+        return 1
+
+    if (missing or unbaselined) and not arguments.allow_missing:
+        print("%d baseline benchmarks missing from the results, %d results missing from the baseline"
+              % (len(missing), len(unbaselined)))
+        return 1
+
+    print("no benchmark regressed by more than %.0f%%" % (arguments.threshold * 100.0))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
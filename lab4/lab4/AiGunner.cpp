@@ -0,0 +1,229 @@
+// Author: Michal K.
+
+#include "AiGunner.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "VectorFormulas.h"
+
+
+/// default constructor
+/// <param name="t_mode">mode played, or both in turn</param>
+/// <param name="t_timePerTick">simulation's fixed step, menus count ticks since they do not count time</param>
+AiGunner::AiGunner(Mode t_mode, sf::Time t_timePerTick) :
+	m_mode{ t_mode },
+	m_menuTicks{ static_cast<std::uint32_t>(MENU_SECONDS / t_timePerTick.asSeconds()) }
+{
+	m_engagements.reserve(World::MAX_LASERS); // an engagement per laser, more are never fired at once
+}
+
+
+/// one key press or click per tick, like a player
+/// menus are looked at for a moment first so every screen gets drawn while soak testing
+bool AiGunner::nextEvent(const Simulation & t_simulation, sf::Event & t_event)
+{
+	const std::uint32_t tick = t_simulation.tick();
+
+	if (tick == m_lastTick) // asked again before the tick ran
+	{
+		return false;
+	}
+	m_lastTick = tick;
+
+	if (t_simulation.gameState() != m_screen) // new screen, nothing aimed at before is alive any more
+	{
+		m_screen = t_simulation.gameState();
+		m_screenTick = tick;
+		m_engagements.clear();
+	}
+
+	const bool looked = tick - m_screenTick >= m_menuTicks; // menu has been on screen long enough
+
+	if (m_screen == Simulation::mainMenu && looked)
+	{
+		const bool playCustom = m_mode == custom || (m_mode == alternate && m_nextCustom);
+		m_nextCustom = !m_nextCustom;
+		m_games++;
+
+		t_event.type = sf::Event::KeyPressed;
+		t_event.key.code = playCustom ? sf::Keyboard::Num2 : sf::Keyboard::Num1;
+		t_event.key.alt = false;
+		t_event.key.control = false;
+		t_event.key.shift = false;
+		t_event.key.system = false;
+		return true;
+	}
+
+	if (m_screen == Simulation::gameOver && looked)
+	{
+		t_event.type = sf::Event::KeyPressed;
+		t_event.key.code = sf::Keyboard::Space;
+		t_event.key.alt = false;
+		t_event.key.control = false;
+		t_event.key.shift = false;
+		t_event.key.system = false;
+		return true;
+	}
+
+	sf::Vector2f target; // where the laser is sent
+	if ((m_screen == Simulation::classicMode || m_screen == Simulation::customMode) && aim(t_simulation, target))
+	{
+		m_shots++;
+
+		// clicks are whole playfield pixels, same as Game::processEvents() makes them
+		t_event.type = sf::Event::MouseButtonPressed;
+		t_event.mouseButton.button = sf::Mouse::Left;
+		t_event.mouseButton.x = static_cast<int>(std::round(target.x));
+		t_event.mouseButton.y = static_cast<int>(std::round(target.y));
+		return true;
+	}
+
+	return false;
+}
+
+
+/// classic, custom or alternate
+AiGunner::Mode AiGunner::modeFromName(const std::string & t_name)
+{
+	if (t_name == "custom")
+	{
+		return custom;
+	}
+
+	if (t_name == "alternate")
+	{
+		return alternate;
+	}
+
+	return classic;
+}
+
+
+/// aims at the asteroid that reaches the ground first, unless a shot is already on its way to it
+/// fire is held until the power bar can climb to the intercept, power spent on a less urgent asteroid would be missed
+/// an asteroid that can no longer be met above the ground is given up on
+/// <param name="t_aim">click position, set when true is returned</param>
+bool AiGunner::aim(const Simulation & t_simulation, sf::Vector2f & t_aim)
+{
+	const double now = t_simulation.time();
+	m_engagements.erase(std::remove_if(m_engagements.begin(), m_engagements.end(),
+		[now](const Engagement & t_engagement) { return t_engagement.until <= now; }), m_engagements.end());
+
+	const World & world = t_simulation.world(); // every asteroid, laser and explosion alive
+	const ComponentPool<Collider> & colliders = world.colliders(); // asteroids and explosions
+	const sf::Vector2f base{ Simulation::BASE_CENTRE, Simulation::GROUND_TOP }; // lasers start here
+	float soonest = std::numeric_limits<float>::max(); // seconds until the target reaches the ground
+	float flightTime = 0.0f; // laser's flight to the target's intercept
+
+	for (std::size_t i = 0u; i < colliders.size(); i++)
+	{
+		if (colliders[i].layer != Collider::asteroid || engaged(colliders.entity(i)))
+		{
+			continue;
+		}
+
+		const sf::Vector2f tip = world.transforms().get(colliders.entity(i)).tipPoint;
+		const sf::Vector2f velocity = world.velocities().get(colliders.entity(i)).perSecond;
+		const float groundTime = velocity.y > 0.0f ? (Simulation::GROUND_TOP - tip.y) / velocity.y : soonest;
+		float time = 0.0f; // laser's flight to this asteroid
+
+		if (groundTime >= soonest || !interceptTime(tip, velocity, t_simulation.laserSpeed(), EXPLOSION_LEAD, time))
+		{
+			continue;
+		}
+
+		const sf::Vector2f point = tip + velocity * (time + EXPLOSION_LEAD); // where the explosion goes
+		if (point.x >= 0.0f && point.x <= Simulation::WIDTH && point.y >= 0.0f && point.y < Simulation::GROUND_TOP)
+		{
+			soonest = groundTime;
+			flightTime = time;
+			t_aim = point;
+		}
+	}
+
+	// laser stops at its altitude, GROUND_TOP - power, so it needs enough power to climb to the intercept
+	if (soonest == std::numeric_limits<float>::max() || t_simulation.currentPower() < base.y - t_aim.y)
+	{
+		return false;
+	}
+
+	engage(t_simulation, t_aim, flightTime);
+	return true;
+}
+
+
+/// every asteroid the explosion at t_aim will be on top of is left to that shot
+/// only asteroids within half the explosion's final radius count, ones at its edge may slip past it
+void AiGunner::engage(const Simulation & t_simulation, sf::Vector2f t_aim, float t_flightTime)
+{
+	const World & world = t_simulation.world();
+	const ComponentPool<Collider> & colliders = world.colliders();
+	const float reach = World::MAX_EXPLOSION_RADIUS * 0.5f; // distance from the centre an asteroid is sure to be hit at
+	const double until = t_simulation.time() + t_flightTime + World::MAX_EXPLOSION_RADIUS / World::EXPLOSION_GROWTH;
+
+	for (std::size_t i = 0u; i < colliders.size() && m_engagements.size() < m_engagements.capacity(); i++)
+	{
+		if (colliders[i].layer != Collider::asteroid)
+		{
+			continue;
+		}
+
+		const Entity asteroid = colliders.entity(i);
+		const sf::Vector2f tip = world.transforms().get(asteroid).tipPoint;
+		const sf::Vector2f velocity = world.velocities().get(asteroid).perSecond;
+
+		if (vectorLength(tip + velocity * (t_flightTime + EXPLOSION_LEAD) - t_aim) <= reach)
+		{
+			Engagement engagement;
+			engagement.asteroid = asteroid;
+			engagement.until = until;
+			m_engagements.push_back(engagement);
+		}
+	}
+}
+
+
+/// a shot is on its way to the asteroid
+bool AiGunner::engaged(Entity t_asteroid) const
+{
+	for (const Engagement & engagement : m_engagements)
+	{
+		if (engagement.asteroid == t_asteroid)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+
+/// solves |tip + velocity * (t + lead) - base| = laserSpeed * t for the smallest t above zero
+/// the quadratic in t is (v.v - s^2) t^2 + 2 (d.v) t + d.d = 0 with d the lead point relative to the base
+/// <param name="t_flightTime">seconds the laser flies, set when true is returned</param>
+bool AiGunner::interceptTime(sf::Vector2f t_tip, sf::Vector2f t_velocity, float t_laserSpeed, float t_lead, float & t_flightTime)
+{
+	const sf::Vector2f offset = t_tip + t_velocity * t_lead - sf::Vector2f{ Simulation::BASE_CENTRE, Simulation::GROUND_TOP };
+	const float a = t_velocity.x * t_velocity.x + t_velocity.y * t_velocity.y - t_laserSpeed * t_laserSpeed;
+	const float b = 2.0f * (offset.x * t_velocity.x + offset.y * t_velocity.y);
+	const float c = offset.x * offset.x + offset.y * offset.y;
+
+	if (std::abs(a) < 0.0001f) // asteroid as fast as the laser, the quadratic is linear
+	{
+		t_flightTime = b < 0.0f ? -c / b : -1.0f;
+		return t_flightTime > 0.0f;
+	}
+
+	const float discriminant = b * b - 4.0f * a * c;
+	if (discriminant < 0.0f) // asteroid outruns the laser
+	{
+		return false;
+	}
+
+	const float root = std::sqrt(discriminant);
+	const float first = (-b - root) / (2.0f * a);
+	const float second = (-b + root) / (2.0f * a);
+
+	t_flightTime = first > 0.0f && (second <= 0.0f || first < second) ? first : second;
+	return t_flightTime > 0.0f;
+}
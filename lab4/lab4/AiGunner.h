@@ -0,0 +1,60 @@
+// Author: Michal K.
+
+#ifndef AI_GUNNER
+#define AI_GUNNER
+
+#include <string>
+#include <vector>
+#include "InputSource.h"
+#include "Simulation.h"
+
+// plays classic or custom mode for as long as it is left running, through the same events a player makes
+// presses 1 or 2 on the main menu, space on game over, and clicks where a laser fired now meets an asteroid
+// the most urgent asteroid is aimed at first, the shot waits until the power bar reaches the intercept
+// its clicks are recorded like a player's, so a long session can be replayed with the profiler on
+class AiGunner : public InputSource
+{
+public:
+	enum Mode { classic, custom, alternate }; // alternate switches mode every game
+
+	// t_timePerTick is the simulation's fixed step, menus are looked at for a moment before a key is pressed
+	AiGunner(Mode t_mode, sf::Time t_timePerTick);
+
+	// at most one key press or click per tick, false once the tick's event was made or there is nothing to do
+	bool nextEvent(const Simulation & t_simulation, sf::Event & t_event) override;
+
+	static Mode modeFromName(const std::string & t_name); // classic, custom or alternate, classic if unknown
+
+	unsigned gamesStarted() const { return m_games; }
+	unsigned shotsFired() const { return m_shots; }
+
+private:
+	static constexpr float MENU_SECONDS = 1.0f; // time spent on a menu or game over screen before pressing a key
+	static constexpr float EXPLOSION_LEAD = 0.25f; // seconds the explosion has to grow into the asteroid's path, half its life
+
+	struct Engagement
+	{
+		Entity asteroid = NO_ENTITY; // asteroid a laser is on its way to
+		double until = 0.0; // simulation time the explosion is over, aimed at again afterwards if it survived
+	};
+
+	bool aim(const Simulation & t_simulation, sf::Vector2f & t_aim); // click for the most urgent asteroid, false to hold fire
+	void engage(const Simulation & t_simulation, sf::Vector2f t_aim, float t_flightTime); // asteroids the shot will hit
+	bool engaged(Entity t_asteroid) const;
+
+	// seconds until a laser fired now from the base meets the point t_tip moves to t_lead seconds after it, false if never
+	static bool interceptTime(sf::Vector2f t_tip, sf::Vector2f t_velocity, float t_laserSpeed, float t_lead, float & t_flightTime);
+
+	const Mode m_mode; // mode or modes played
+	const std::uint32_t m_menuTicks; // ticks spent on a menu before pressing a key
+	bool m_nextCustom = false; // mode picked on the next main menu when alternating
+	std::uint32_t m_lastTick = UINT32_MAX; // tick the last decision was made on, one per tick
+	Simulation::m_gameState m_screen = Simulation::gameOver; // game state seen last tick
+	std::uint32_t m_screenTick = 0u; // tick m_screen was first seen on
+	std::vector<Engagement> m_engagements; // shots still on their way, reserved for every laser that can be alive
+
+	unsigned m_games = 0u; // games started
+	unsigned m_shots = 0u; // clicks made
+};
+
+#endif // !AI_GUNNER
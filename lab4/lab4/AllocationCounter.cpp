@@ -0,0 +1,74 @@
+// Author: Michal K.
+
+#include "AllocationCounter.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+static std::atomic<std::size_t> s_allocationCount{ 0u }; // global operator new calls so far
+static thread_local std::size_t s_threadAllocationCount = 0u; // global operator new calls so far on this thread
+
+
+/// number of global operator new calls since the program started
+std::size_t allocationCount()
+{
+	return s_allocationCount.load(std::memory_order_relaxed);
+}
+
+
+/// number of global operator new calls made by the calling thread since it started
+std::size_t threadAllocationCount()
+{
+	return s_threadAllocationCount;
+}
+
+
+/// counts allocation and forwards to malloc
+void * operator new(std::size_t t_size)
+{
+	s_allocationCount.fetch_add(1u, std::memory_order_relaxed);
+	s_threadAllocationCount++;
+
+	void * memory = std::malloc(t_size == 0u ? 1u : t_size); // zero sized allocations need a unique address
+	if (memory == nullptr)
+	{
+		throw std::bad_alloc{};
+	}
+
+	return memory;
+}
+
+
+/// counts array allocation and forwards to malloc
+void * operator new[](std::size_t t_size)
+{
+	return operator new(t_size);
+}
+
+
+/// releases memory from operator new
+void operator delete(void * t_memory) noexcept
+{
+	std::free(t_memory);
+}
+
+
+/// releases memory from operator new[]
+void operator delete[](void * t_memory) noexcept
+{
+	std::free(t_memory);
+}
+
+
+/// sized release of memory from operator new
+void operator delete(void * t_memory, std::size_t) noexcept
+{
+	std::free(t_memory);
+}
+
+
+/// sized release of memory from operator new[]
+void operator delete[](void * t_memory, std::size_t) noexcept
+{
+	std::free(t_memory);
+}
@@ -0,0 +1,16 @@
+// Author: Michal K.
+
+#ifndef ALLOCATION_COUNTER
+#define ALLOCATION_COUNTER
+
+#include <cstddef>
+
+// number of global operator new calls since the program started
+// difference of two calls gives the heap allocations made by the code in between
+std::size_t allocationCount();
+
+// same as allocationCount() but only counting calls made on the calling thread
+// the game loop and the simulation thread can each check their own work while the other one runs
+std::size_t threadAllocationCount();
+
+#endif // !ALLOCATION_COUNTER
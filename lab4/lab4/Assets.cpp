@@ -0,0 +1,162 @@
+// Author: Michal K.
+
+#include "Assets.h"
+#include <fstream>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+/// path of a file in the ASSETS folder
+/// LAB4_ASSET_DIR is defined by the CMake build as the source ASSETS folder
+/// <param name="t_relative">file inside ASSETS, such as "FONTS/ariblk.ttf"</param>
+/// <returns>first path that can be opened, else the working directory path so the load error names it</returns>
+std::string assetPath(const std::string & t_relative)
+{
+	const std::string local = "ASSETS/" + t_relative; // next to the working directory
+
+	if (std::ifstream{ local })
+	{
+		return local;
+	}
+
+#ifdef LAB4_ASSET_DIR
+	const std::string configured = std::string{ LAB4_ASSET_DIR } + "/" + t_relative; // source folder of the build
+
+	if (std::ifstream{ configured })
+	{
+		return configured;
+	}
+#endif
+
+	return local;
+}
+
+
+/// unmaps or frees the bytes
+AssetFile::~AssetFile()
+{
+	close();
+}
+
+
+/// every byte of the file is made available through data()
+/// <param name="t_path">file to open, see assetPath()</param>
+/// <param name="t_map">map the file instead of reading it, empty files and failed mappings are read</param>
+/// <returns>false if the file cannot be opened</returns>
+bool AssetFile::open(const std::string & t_path, bool t_map)
+{
+	close();
+
+	if (t_map && map(t_path))
+	{
+		return true;
+	}
+
+	std::ifstream file{ t_path, std::ios::binary | std::ios::ate };
+	if (!file)
+	{
+		return false;
+	}
+
+	m_bytes.resize(static_cast<std::size_t>(file.tellg()));
+	file.seekg(0);
+	file.read(m_bytes.data(), static_cast<std::streamsize>(m_bytes.size()));
+
+	m_data = m_bytes.data();
+	m_size = m_bytes.size();
+	return static_cast<bool>(file);
+}
+
+
+/// bytes are released, a mapping is unmapped
+void AssetFile::close()
+{
+	if (m_mapping != nullptr)
+	{
+#ifdef _WIN32
+		UnmapViewOfFile(m_mapping);
+#else
+		munmap(m_mapping, m_size);
+#endif
+		m_mapping = nullptr;
+	}
+
+	std::vector<char>{}.swap(m_bytes); // memory goes back to the heap, clear() would keep it
+	m_data = nullptr;
+	m_size = 0u;
+}
+
+
+/// maps the whole file read only, the handles are closed straight away as the view keeps the file open
+/// <returns>false if the file is empty or cannot be mapped, the caller reads it instead</returns>
+bool AssetFile::map(const std::string & t_path)
+{
+#ifdef _WIN32
+	const HANDLE file = CreateFileA(t_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+	{
+		return false;
+	}
+
+	LARGE_INTEGER size;
+	HANDLE mapping = nullptr; // file mapping object, only needed until the view exists
+	if (GetFileSizeEx(file, &size) && size.QuadPart > 0)
+	{
+		mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	}
+	CloseHandle(file);
+
+	if (mapping == nullptr)
+	{
+		return false;
+	}
+
+	m_mapping = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(mapping);
+	m_size = static_cast<std::size_t>(size.QuadPart);
+#else
+	const int file = ::open(t_path.c_str(), O_RDONLY);
+	if (file < 0)
+	{
+		return false;
+	}
+
+	struct stat status;
+	void * view = MAP_FAILED; // stays failed for an empty file, mmap() refuses zero bytes
+	if (fstat(file, &status) == 0 && status.st_size > 0)
+	{
+		view = mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+	}
+	::close(file);
+
+	if (view == MAP_FAILED)
+	{
+		return false;
+	}
+
+	m_mapping = view;
+	m_size = static_cast<std::size_t>(status.st_size);
+#endif
+
+	if (m_mapping == nullptr)
+	{
+		m_size = 0u;
+		return false;
+	}
+
+	m_data = m_mapping;
+	return true;
+}
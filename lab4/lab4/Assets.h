@@ -0,0 +1,42 @@
+// Author: Michal K.
+
+#ifndef ASSETS
+#define ASSETS
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// path of a file in the ASSETS folder, t_relative uses forward slashes on every platform
+// ASSETS next to the working directory is used first, as Visual Studio runs the game from the project folder
+// otherwise the folder the build was configured with, so a CMake build runs from any directory
+std::string assetPath(const std::string & t_relative);
+
+// every byte of one file, read into memory or mapped into it by the operating system
+// a mapped file is only paged in as it is used, a font reads its glyph outlines straight from the mapping
+class AssetFile
+{
+public:
+	AssetFile() = default;
+	~AssetFile(); // unmaps or frees the bytes
+
+	AssetFile(const AssetFile &) = delete;
+	AssetFile & operator=(const AssetFile &) = delete;
+
+	bool open(const std::string & t_path, bool t_map); // false if the file cannot be read, t_map falls back to reading
+	void close(); // bytes are released, data() is no longer valid
+
+	const void * data() const { return m_data; }
+	std::size_t size() const { return m_size; }
+	bool mapped() const { return m_mapping != nullptr; } // bytes come from a mapping rather than a copy
+
+private:
+	bool map(const std::string & t_path); // maps the whole file read only
+
+	std::vector<char> m_bytes; // copy of the file when it is read
+	const void * m_data = nullptr; // first byte, in m_bytes or in the mapping
+	std::size_t m_size = 0u; // bytes in the file
+	void * m_mapping = nullptr; // start of the mapped view, null when read
+};
+
+#endif // !ASSETS
@@ -0,0 +1,172 @@
+// Author: Michal K.
+
+#include "BatchRenderer.h"
+#include <algorithm>
+#include <cmath>
+#include "Trail.h"
+#include "VectorFormulas.h"
+
+
+/// unit circle used by every ring is worked out once
+BatchRenderer::BatchRenderer()
+{
+	for (std::size_t i = 0u; i <= RING_SEGMENTS; i++)
+	{
+		const float angle = 2.0f * PI * (i % RING_SEGMENTS) / RING_SEGMENTS; // radians around the circle
+		m_ringDirections[i] = sf::Vector2f{ std::cos(angle), std::sin(angle) };
+	}
+}
+
+
+/// adds a rectangle that never moves, only before uploadStatic()
+void BatchRenderer::addStaticRect(const sf::RectangleShape & t_rectangle)
+{
+	const sf::Vector2f topLeft = t_rectangle.getPosition(); // shapes in this game have no origin or rotation
+	const sf::Vector2f size = t_rectangle.getSize();
+
+	appendQuad(m_staticVertices, topLeft, topLeft + sf::Vector2f{ size.x, 0.0f }, topLeft + size,
+		topLeft + sf::Vector2f{ 0.0f, size.y }, t_rectangle.getFillColor(), sf::Vector2f{ 0.0f, 0.0f });
+}
+
+
+/// sends static geometry to the graphics card, frames after this only draw it
+/// if vertex buffers are not supported the vertices are drawn from memory instead
+void BatchRenderer::uploadStatic()
+{
+	if (sf::VertexBuffer::isAvailable() && m_staticBuffer.create(m_staticVertices.size()))
+	{
+		m_staticUploaded = m_staticBuffer.update(m_staticVertices.data());
+	}
+}
+
+
+/// texture every text is drawn from, shapes drawn with it sample its white corner
+void BatchRenderer::setAtlas(const GlyphAtlas & t_atlas)
+{
+	m_atlas = &t_atlas;
+	m_whitePixel = t_atlas.whitePixel();
+}
+
+
+/// starts a new frame, triangles go into the frame's arena with room for as many as the busiest frame had
+/// the old list is never touched again, it went with the arena's reset
+/// <param name="t_showStatic">draw ground and base this frame</param>
+/// <param name="t_arena">frame's arena, reset since the last frame</param>
+void BatchRenderer::clear(bool t_showStatic, FrameArena & t_arena)
+{
+	m_showStatic = t_showStatic;
+	m_triangles = t_arena.create<FrameVector<sf::Vertex>>(t_arena);
+	m_triangles->reserve(m_maxTriangles);
+	m_textStart = 0u;
+	m_lines.clear();
+	m_lineCount = 0u;
+}
+
+
+/// filled rectangle with the position, size and fill colour of the shape
+void BatchRenderer::addRect(const sf::RectangleShape & t_rectangle)
+{
+	const sf::Vector2f topLeft = t_rectangle.getPosition(); // shapes in this game have no origin or rotation
+	const sf::Vector2f size = t_rectangle.getSize();
+
+	appendQuad(*m_triangles, topLeft, topLeft + sf::Vector2f{ size.x, 0.0f }, topLeft + size,
+		topLeft + sf::Vector2f{ 0.0f, size.y }, t_rectangle.getFillColor(), m_whitePixel);
+	m_textStart = m_triangles->size();
+	m_maxTriangles = std::max(m_maxTriangles, m_triangles->size());
+}
+
+
+/// circle outline from t_radius to t_radius + t_thickness, like a sf::CircleShape outline
+void BatchRenderer::addRing(sf::Vector2f t_centre, float t_radius, float t_thickness, sf::Color t_color)
+{
+	const float outerRadius = t_radius + t_thickness; // outline grows outwards
+
+	for (std::size_t i = 0u; i < RING_SEGMENTS; i++)
+	{
+		const sf::Vector2f from = m_ringDirections[i]; // start of segment on unit circle
+		const sf::Vector2f to = m_ringDirections[i + 1u]; // end of segment on unit circle
+
+		appendQuad(*m_triangles, t_centre + from * t_radius, t_centre + to * t_radius,
+			t_centre + to * outerRadius, t_centre + from * outerRadius, t_color, m_whitePixel);
+	}
+
+	m_textStart = m_triangles->size();
+	m_maxTriangles = std::max(m_maxTriangles, m_triangles->size());
+}
+
+
+/// white one pixel line from start to tip
+void BatchRenderer::addLine(sf::Vector2f t_start, sf::Vector2f t_tip)
+{
+	setTrail(m_lines, m_lineCount++, t_start, t_tip);
+}
+
+
+/// every vertex of the text is copied as it is, text only lays itself out again when it changed
+void BatchRenderer::addText(const AtlasText & t_text)
+{
+	const std::vector<sf::Vertex> & vertices = t_text.vertices();
+	m_triangles->insert(m_triangles->end(), vertices.begin(), vertices.end());
+	m_maxTriangles = std::max(m_maxTriangles, m_triangles->size());
+}
+
+
+/// draw calls the current frame takes, one per non empty batch
+/// shapes and text are one call unless trails have to go between them
+std::size_t BatchRenderer::drawCalls() const
+{
+	const std::size_t triangles = m_triangles == nullptr ? 0u : m_triangles->size(); // shapes and text
+	const bool splitText = m_lineCount > 0u && m_textStart > 0u && m_textStart < triangles; // trails drawn between shapes and text
+
+	return (m_showStatic && !m_staticVertices.empty() ? 1u : 0u) + (triangles > 0u ? 1u : 0u) + (splitText ? 1u : 0u)
+		+ (m_lineCount > 0u ? 1u : 0u);
+}
+
+
+/// static geometry first, then rectangles and rings, then lines on top
+void BatchRenderer::draw(sf::RenderTarget & t_target, sf::RenderStates t_states) const
+{
+	if (m_showStatic && m_staticUploaded)
+	{
+		t_target.draw(m_staticBuffer, t_states);
+	}
+	else if (m_showStatic && !m_staticVertices.empty())
+	{
+		t_target.draw(m_staticVertices.data(), m_staticVertices.size(), sf::Triangles, t_states);
+	}
+
+	const std::size_t triangles = m_triangles == nullptr ? 0u : m_triangles->size(); // shapes and text
+	const std::size_t textStart = m_lineCount > 0u ? std::min(m_textStart, triangles) : 0u; // drawn after the trails
+	sf::RenderStates textured = t_states; // shapes read white from the atlas corner
+	textured.texture = m_atlas != nullptr ? &m_atlas->texture() : nullptr;
+
+	if (textStart > 0u)
+	{
+		t_target.draw(m_triangles->data(), textStart, sf::Triangles, textured);
+	}
+
+	if (m_lineCount > 0u)
+	{
+		t_target.draw(m_lines, t_states);
+	}
+
+	if (triangles > textStart)
+	{
+		t_target.draw(m_triangles->data() + textStart, triangles - textStart, sf::Triangles, textured);
+	}
+}
+
+
+/// two triangles covering the quad a, b, c, d given in winding order, every corner sampling the same texel
+template <typename Vertices>
+void BatchRenderer::appendQuad(Vertices & t_vertices, sf::Vector2f t_a, sf::Vector2f t_b,
+	sf::Vector2f t_c, sf::Vector2f t_d, sf::Color t_color, sf::Vector2f t_texCoords)
+{
+	t_vertices.emplace_back(t_a, t_color, t_texCoords);
+	t_vertices.emplace_back(t_b, t_color, t_texCoords);
+	t_vertices.emplace_back(t_c, t_color, t_texCoords);
+
+	t_vertices.emplace_back(t_a, t_color, t_texCoords);
+	t_vertices.emplace_back(t_c, t_color, t_texCoords);
+	t_vertices.emplace_back(t_d, t_color, t_texCoords);
+}
@@ -0,0 +1,61 @@
+// Author: Michal K.
+
+#ifndef BATCH_RENDERER
+#define BATCH_RENDERER
+
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <vector>
+#include "FrameArena.h"
+#include "GlyphAtlas.h"
+
+// collects every shape and text of a frame so the whole scene is drawn in at most four draw calls
+// static geometry (ground, base) is uploaded once to a vertex buffer, rectangles, explosion rings and text
+// go into one triangle list and projectile trails into one line list, both rebuilt every frame
+// text is textured from a GlyphAtlas, shapes sample its white corner so the same triangle list draws both
+// text is drawn after the trails, a frame without trails draws every triangle in one call
+// the triangle list and the vector holding it live in the frame's arena and are dropped with it, nothing is freed
+class BatchRenderer : public sf::Drawable
+{
+public:
+	static const std::size_t RING_SEGMENTS = 30u; // same point count as sf::CircleShape
+
+	BatchRenderer();
+
+	void addStaticRect(const sf::RectangleShape & t_rectangle); // only before uploadStatic()
+	void uploadStatic(); // sends static geometry to the graphics card, called once after setup
+	void setAtlas(const GlyphAtlas & t_atlas); // texture every text is drawn from, before the first frame
+
+	void clear(bool t_showStatic, FrameArena & t_arena); // starts a new frame, t_arena must have been reset since the last one
+	void addRect(const sf::RectangleShape & t_rectangle); // filled rectangle, position, size and fill colour of the shape
+	void addRing(sf::Vector2f t_centre, float t_radius, float t_thickness, sf::Color t_color); // circle outline drawn outside t_radius
+	void addLine(sf::Vector2f t_start, sf::Vector2f t_tip); // white one pixel line, see setTrail()
+	void addText(const AtlasText & t_text); // after every shape of the frame, from the atlas given to setAtlas()
+
+	std::size_t drawCalls() const; // draw calls the current frame takes
+
+private:
+	void draw(sf::RenderTarget & t_target, sf::RenderStates t_states) const override;
+
+	// two triangles covering the quad a, b, c, d given in winding order, to any vector of vertices
+	template <typename Vertices>
+	static void appendQuad(Vertices & t_vertices, sf::Vector2f t_a, sf::Vector2f t_b,
+		sf::Vector2f t_c, sf::Vector2f t_d, sf::Color t_color, sf::Vector2f t_texCoords);
+
+	std::vector<sf::Vertex> m_staticVertices; // ground and base, kept for when vertex buffers are not supported
+	sf::VertexBuffer m_staticBuffer{ sf::Triangles, sf::VertexBuffer::Static }; // ground and base on the graphics card
+	bool m_staticUploaded = false; // m_staticBuffer holds m_staticVertices
+	bool m_showStatic = false; // static geometry is part of this frame
+
+	FrameVector<sf::Vertex> * m_triangles = nullptr; // rectangles and rings of this frame, in the frame's arena
+	std::size_t m_maxTriangles = 0u; // most triangle vertices of any frame, reserved up front so the list never regrows
+	std::size_t m_textStart = 0u; // first text vertex in the triangle list, its size if there is no text
+	const GlyphAtlas * m_atlas = nullptr; // texture of the text
+	sf::Vector2f m_whitePixel{ 0.0f, 0.0f }; // texture coordinates of the atlas's white corner, for shapes
+	sf::VertexArray m_lines{ sf::Lines }; // trails of this frame
+	std::size_t m_lineCount = 0u; // lines written to m_lines this frame
+
+	std::array<sf::Vector2f, RING_SEGMENTS + 1u> m_ringDirections; // unit circle points, last repeats the first
+};
+
+#endif // !BATCH_RENDERER
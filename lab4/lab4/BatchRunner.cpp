@@ -0,0 +1,146 @@
+// Author: Michal K.
+
+#include "BatchRunner.h"
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <vector>
+#include "Simulation.h"
+#include "AiGunner.h"
+#include "InputRecording.h"
+#include "ThreadPool.h"
+
+namespace
+{
+	const double MAX_GAME_SECONDS = 3600.0; // game time after which a game is stopped as survived
+
+	// outcome of one game
+	struct GameResult
+	{
+		int score = 0; // score at game over
+		int level = 1; // player level at game over
+		double seconds = 0.0; // game time survived
+		bool survived = false; // still alive after MAX_GAME_SECONDS
+	};
+
+	/// plays one custom mode game with the AI gunner until game over or MAX_GAME_SECONDS
+	/// ticks are skipped only while no asteroid is in the air, so every shot is still taken on its own tick
+	GameResult playGame(const Settings & t_settings, std::uint64_t t_seed, unsigned t_waveSize, sf::Time t_timePerTick)
+	{
+		Simulation simulation{ t_waveSize, false, t_seed, t_settings };
+		AiGunner gunner{ AiGunner::custom, t_timePerTick }; // same aim as --ai and the soak test
+		InputRecorder recorder; // never opened, sweep games are not recorded
+
+		simulation.update(t_timePerTick); // main menu resets the game
+		simulation.setGameState(Simulation::customMode);
+
+		while (simulation.gameState() != Simulation::gameOver && simulation.time() < MAX_GAME_SECONDS)
+		{
+			if (simulation.world().asteroidCount() == 0u) // nothing to shoot, jump to the next wave
+			{
+				simulation.skipTicks(simulation.ticksUntilNextEvent(t_timePerTick), t_timePerTick);
+			}
+
+			feedSourceEvents(simulation, gunner, recorder);
+			simulation.update(t_timePerTick);
+		}
+
+		GameResult result;
+		result.score = simulation.score();
+		result.level = simulation.playerLvl();
+		result.seconds = simulation.time();
+		result.survived = simulation.gameState() != Simulation::gameOver;
+		return result;
+	}
+}
+
+
+/// queues every game of every tuning on the thread pool, waits, then writes one csv line per tuning
+/// each game writes only its own slot of the results so no locking is needed
+/// game i is seeded with t_options.seed + i % games, so every tuning faces the same waves
+/// every tuning is t_settings with the swept values of custom mode replaced, the grid is the sweep ranges of t_options
+void runBatch(const Options & t_options, const Settings & t_settings)
+{
+	std::vector<Settings> tunings; // every combination of the grid
+	for (unsigned speed = 0u; speed < t_options.sweepSpeedIncrement.steps; speed++)
+	{
+		for (unsigned decay = 0u; decay < t_options.sweepXpDecay.steps; decay++)
+		{
+			for (unsigned power = 0u; power < t_options.sweepMaxPower.steps; power++)
+			{
+				Settings tuning = t_settings;
+				tuning.custom.asteroidSpeedIncrement = t_options.sweepSpeedIncrement.value(speed);
+				tuning.custom.xpGainDecay = t_options.sweepXpDecay.value(decay);
+				tuning.custom.maxPower = t_options.sweepMaxPower.value(power);
+				tunings.push_back(tuning);
+			}
+		}
+	}
+
+	const unsigned games = t_options.batchGames; // games per tuning
+	const sf::Time timePerTick = sf::seconds(1.0f / t_options.tickRate); // same step the windowed game uses
+	std::vector<GameResult> results(tunings.size() * games); // game i of tuning t is at t * games + i
+	sf::Clock clock;
+
+	{
+		ThreadPool pool{ t_options.batchThreads };
+		std::cout << "batch: " << results.size() << " games on " << pool.size() << " threads" << std::endl;
+
+		for (std::size_t i = 0u; i < results.size(); i++)
+		{
+			pool.submit([&, i]
+			{
+				results[i] = playGame(tunings[i / games], t_options.seed + i % games, t_options.waveSize, timePerTick);
+			});
+		}
+
+		pool.wait();
+	}
+
+	const float seconds = clock.getElapsedTime().asSeconds(); // wall clock time of every game
+	double gameSeconds = 0.0; // game time of every game
+	for (const GameResult & result : results)
+	{
+		gameSeconds += result.seconds;
+	}
+
+	std::cout << "batch: " << results.size() << " games in " << seconds << " s, "
+		<< (seconds > 0.0f ? results.size() / seconds : 0.0f) << " games per second, "
+		<< gameSeconds / 3600.0 << " hours of game time" << std::endl;
+
+	std::ofstream file{ t_options.batchPath };
+	if (!file)
+	{
+		std::cout << "problem writing batch results to " << t_options.batchPath << std::endl;
+		return;
+	}
+
+	file << "asteroid_speed_increment,xp_gain_decay,max_power,games,mean_score,max_score,mean_level,max_level,mean_seconds,survived\n";
+
+	for (std::size_t t = 0u; t < tunings.size(); t++)
+	{
+		double scoreSum = 0.0; // for mean score
+		double levelSum = 0.0; // for mean level
+		double secondsSum = 0.0; // for mean survival time
+		int maxScore = 0; // best game
+		int maxLevel = 0; // highest level reached
+		unsigned survived = 0u; // games stopped at MAX_GAME_SECONDS
+
+		for (std::size_t i = t * games; i < (t + 1u) * games; i++)
+		{
+			scoreSum += results[i].score;
+			levelSum += results[i].level;
+			secondsSum += results[i].seconds;
+			maxScore = std::max(maxScore, results[i].score);
+			maxLevel = std::max(maxLevel, results[i].level);
+			survived += results[i].survived ? 1u : 0u;
+		}
+
+		const Tuning & custom = tunings[t].custom; // swept values
+		file << custom.asteroidSpeedIncrement << ',' << custom.xpGainDecay << ',' << custom.maxPower << ','
+			<< games << ',' << scoreSum / games << ',' << maxScore << ',' << levelSum / games << ',' << maxLevel << ','
+			<< secondsSum / games << ',' << survived << '\n';
+	}
+
+	std::cout << "batch: results written to " << t_options.batchPath << std::endl;
+}
@@ -0,0 +1,16 @@
+// Author: Michal K.
+
+#ifndef BATCH_RUNNER
+#define BATCH_RUNNER
+
+#include "Options.h"
+#include "Settings.h"
+
+// plays t_options.batchGames custom mode games for every tuning in a grid of asteroid speed, xp decay and max power
+// the grid spans the sweep ranges of t_options, --sweep-speed, --sweep-decay and --sweep-power
+// the AI gunner plays every game, aiming as it does for --ai, games run on every core at once through a work stealing thread pool
+// one line per tuning with mean score, level and survival time is written to the t_options.batchPath csv
+// values outside the grid come from t_settings
+void runBatch(const Options & t_options, const Settings & t_settings);
+
+#endif // !BATCH_RUNNER
@@ -0,0 +1,585 @@
+// Author: Michal K.
+
+#include "Benchmark.h"
+#include <algorithm>
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <SFML/Graphics.hpp>
+#include "VectorFormulas.h"
+#include "Trail.h"
+#include "World.h"
+#include "Systems.h"
+#include "CollisionGrid.h"
+#include "VectorBatch.h"
+#include "SimulationThread.h"
+#include "HudValue.h"
+#include "Scene.h"
+
+
+// one measurement of a benchmark, written to the results file
+struct BenchmarkResult
+{
+	std::string name; // benchmark/case, same in every run so results can be compared
+	double value; // measured cost or rate
+	const char * unit; // unit of value
+	bool higherIsBetter; // rates go up when things improve, times go down
+};
+
+static std::vector<BenchmarkResult> benchmarkResults; // every measurement of this run
+
+
+/// keeps a measurement for writeBenchmarkResults()
+static void recordResult(const std::string & t_name, double t_value, const char * t_unit, bool t_higherIsBetter = false)
+{
+	benchmarkResults.push_back(BenchmarkResult{ t_name, t_value, t_unit, t_higherIsBetter });
+}
+
+
+/// fastest of several runs of a timed body in microseconds
+/// the fastest run is the one least disturbed by other processes, so it changes least between runs of the suite
+template <typename Body>
+static float bestOf(int t_runs, Body t_body)
+{
+	float best = 0.0f; // fastest run so far
+
+	for (int run = 0; run < t_runs; run++)
+	{
+		sf::Clock clock;
+		t_body();
+		const float time = static_cast<float>(clock.getElapsedTime().asMicroseconds()); // this run
+
+		best = run == 0 ? time : std::min(best, time);
+	}
+
+	return best;
+}
+
+
+/// average of the first and last tenth of a set of per tick samples
+/// <returns>average of the last tenth</returns>
+static float printFlatness(const std::vector<float> & t_samples, const char * t_name)
+{
+	const std::size_t tenth = t_samples.size() / 10u; // size of first and last tenth
+	float first = 0.0f; // sum of first tenth
+	float last = 0.0f; // sum of last tenth
+
+	for (std::size_t i = 0u; i < tenth; i++)
+	{
+		first += t_samples[i];
+		last += t_samples[t_samples.size() - tenth + i];
+	}
+
+	std::cout << t_name << ": first 10% " << first / tenth << ", last 10% " << last / tenth << std::endl;
+	return last / tenth;
+}
+
+
+/// runs all benchmarks and prints their results
+/// <param name="t_resultsPath">every measurement is written here as json, empty for none</param>
+void runBenchmarks(const std::string & t_resultsPath)
+{
+	benchmarkTrail();
+	benchmarkAsteroidWave();
+	benchmarkCollision();
+	benchmarkVectorBatch();
+	benchmarkVectorInlining();
+	benchmarkSimulationUpdate();
+	benchmarkHud();
+	benchmarkFrame();
+	benchmarkSimulationThread();
+
+	if (!t_resultsPath.empty() && !writeBenchmarkResults(t_resultsPath))
+	{
+		std::cout << "problem writing benchmark results " << t_resultsPath << std::endl;
+	}
+}
+
+
+/// every measurement recorded so far as json, one object per measurement
+/// {"benchmarks": [{"name": "collision/grid/1000", "value": 12.5, "unit": "us", "higher_is_better": false}, ...]}
+/// <returns>false if the file could not be written</returns>
+bool writeBenchmarkResults(const std::string & t_path)
+{
+	std::ofstream file{ t_path };
+	if (!file)
+	{
+		return false;
+	}
+
+	file << "{\n\t\"benchmarks\": [";
+	for (std::size_t i = 0u; i < benchmarkResults.size(); i++)
+	{
+		const BenchmarkResult & result = benchmarkResults[i]; // names and units never need escaping
+		file << (i == 0u ? "\n" : ",\n") << "\t\t{ \"name\": \"" << result.name << "\", \"value\": " << result.value
+			<< ", \"unit\": \"" << result.unit << "\", \"higher_is_better\": " << (result.higherIsBetter ? "true" : "false") << " }";
+	}
+	file << "\n\t]\n}\n";
+
+	return static_cast<bool>(file);
+}
+
+
+/// full 600 pixel asteroid descent at the slowest asteroid speed
+/// the old trail appended two vertices per tick, setTrail() keeps one line per projectile
+/// vertex count and frame time of setTrail() must stay flat for the whole descent
+void benchmarkTrail()
+{
+	const float asteroidSpeed = 0.2f; // slowest asteroid speed, speed after resetAttributes()
+	sf::Vector2f start{ 100.0f, 0.0f }; // start point of asteroid
+	sf::Vector2f velocity = vectorUnitVector(sf::Vector2f{ 600.0f, 600.0f }) * asteroidSpeed; // asteroid velocity
+
+	sf::RenderTexture target; // offscreen target so vsync does not hide draw cost
+	if (!target.create(800u, 600u))
+	{
+		std::cout << "problem creating render texture for trail benchmark" << std::endl;
+		return;
+	}
+
+	for (int pass = 0; pass < 2; pass++) // pass 0 is appended trail, pass 1 is setTrail()
+	{
+		sf::VertexArray trail{ sf::Lines }; // trail being measured
+		sf::Vector2f tip = start; // tip of asteroid
+		std::vector<float> frameTimes; // microseconds per tick
+		std::vector<float> vertexCounts; // vertices submitted per tick
+		sf::Clock clock;
+
+		while (tip.y < 600.0f) // full descent to bottom of screen
+		{
+			clock.restart();
+
+			if (pass == 0)
+			{
+				trail.append(sf::Vertex{ start });
+				trail.append(sf::Vertex{ tip });
+			}
+			else
+			{
+				setTrail(trail, 0u, start, tip);
+			}
+
+			target.clear();
+			target.draw(trail);
+			target.display();
+
+			frameTimes.push_back(static_cast<float>(clock.getElapsedTime().asMicroseconds()));
+			vertexCounts.push_back(static_cast<float>(trail.getVertexCount()));
+			tip += velocity;
+		}
+
+		std::cout << (pass == 0 ? "appended trail" : "setTrail") << ", " << frameTimes.size() << " ticks" << std::endl;
+		printFlatness(vertexCounts, "  vertex count");
+		const float lastFrameTime = printFlatness(frameTimes, "  frame time (us)"); // end of descent, longest trail
+		recordResult(pass == 0 ? "trail/appended" : "trail/set_trail", lastFrameTime, "us");
+	}
+}
+
+
+/// spawn and movement system cost of asteroid waves of growing size
+/// update cost must scale linearly, so nanoseconds per asteroid should stay flat
+void benchmarkAsteroidWave()
+{
+	const std::size_t waveSizes[] = { 1000u, 10000u, 100000u }; // asteroids per wave
+	const int ticks = 600; // ticks integrated per wave, ten seconds of game time
+	World world; // asteroids only, nothing else moves
+	FrameArena arena; // spawn lists
+	Random random{ 1u }; // same asteroids every run
+
+	for (std::size_t waveSize : waveSizes)
+	{
+		// whole batch spawn, best of three
+		const float spawnTime = bestOf(3, [&]()
+		{
+			world.clear();
+			arena.reset();
+			world.spawnAsteroids(waveSize, 12.0f, 800.0f, 600.0f, random, arena);
+		});
+
+		// all ticks, best of three
+		const float integrateTime = bestOf(3, [&]()
+		{
+			for (int tick = 0; tick < ticks; tick++)
+			{
+				movementSystem(world, 1.0f / 60.0f);
+			}
+		});
+
+		std::cout << "asteroid wave of " << waveSize << ": spawn " << spawnTime * 1000.0f / waveSize
+			<< " ns per asteroid, integrate " << integrateTime * 1000.0f / (waveSize * ticks) << " ns per asteroid per tick" << std::endl;
+		recordResult("asteroid_wave/spawn/" + std::to_string(waveSize), spawnTime * 1000.0f / waveSize, "ns");
+		recordResult("asteroid_wave/integrate/" + std::to_string(waveSize), integrateTime * 1000.0f / (waveSize * ticks), "ns");
+	}
+}
+
+
+/// explosion vs asteroid collisions at 100, 1k and 10k entities, half asteroids and half explosions
+/// brute force tests every pair, the grid only tests asteroids in cells an explosion overlaps
+/// both must find the same number of hits, small counts are repeated so every case is timed for a similar while
+void benchmarkCollision()
+{
+	const std::size_t entityCounts[] = { 100u, 1000u, 10000u }; // asteroids plus explosions
+	CollisionGrid grid{ 800.0f, 600.0f, 64.0f }; // same grid as Game
+	std::vector<std::size_t> hits; // asteroids inside an explosion
+	Random random{ 1u }; // same positions every run
+
+	for (std::size_t entityCount : entityCounts)
+	{
+		std::vector<sf::Vector2f> asteroids(entityCount / 2u); // asteroid tips
+		std::vector<sf::Vector2f> explosions(entityCount / 2u); // explosion centres
+		std::vector<float> radii(entityCount / 2u); // explosion radii
+
+		for (std::size_t i = 0u; i < asteroids.size(); i++)
+		{
+			asteroids[i] = sf::Vector2f{ static_cast<float>(random.nextInt(800)), static_cast<float>(random.nextInt(600)) };
+			explosions[i] = sf::Vector2f{ static_cast<float>(random.nextInt(800)), static_cast<float>(random.nextInt(600)) };
+			radii[i] = static_cast<float>(random.nextInt(30));
+		}
+
+		const int passes = static_cast<int>(100000u / entityCount) + 1; // times every case is run per timing
+		std::size_t bruteForceHits = 0u; // pairs found by brute force in the last pass
+
+		// all pairs, best of three
+		const float bruteForceTime = bestOf(3, [&]()
+		{
+			for (int pass = 0; pass < passes; pass++)
+			{
+				bruteForceHits = 0u;
+				for (std::size_t j = 0u; j < explosions.size(); j++)
+				{
+					for (std::size_t i = 0u; i < asteroids.size(); i++)
+					{
+						if (vectorLengthSquared(asteroids[i] - explosions[j]) < radii[j] * radii[j])
+						{
+							bruteForceHits++;
+						}
+					}
+				}
+			}
+		}) / passes;
+
+		std::size_t gridHits = 0u; // pairs found by grid in the last pass
+
+		// build and every query, best of three
+		const float gridTime = bestOf(3, [&]()
+		{
+			for (int pass = 0; pass < passes; pass++)
+			{
+				gridHits = 0u;
+				grid.build(asteroids.data(), asteroids.size());
+				for (std::size_t j = 0u; j < explosions.size(); j++)
+				{
+					hits.clear();
+					grid.queryCircle(explosions[j], radii[j], hits);
+					gridHits += hits.size();
+				}
+			}
+		}) / passes;
+
+		std::cout << "collision with " << entityCount << " entities: brute force " << bruteForceTime
+			<< " us, grid " << gridTime << " us, hits " << bruteForceHits << " / " << gridHits << std::endl;
+		recordResult("collision/brute_force/" + std::to_string(entityCount), bruteForceTime, "us");
+		recordResult("collision/grid/" + std::to_string(entityCount), gridTime, "us");
+	}
+}
+
+
+/// nanoseconds per vector of a benchmark body repeated over the whole array
+/// repeats are split into five runs and the fastest run is kept
+template <typename Body>
+static float nanosecondsPerVector(std::size_t t_count, int t_repeats, Body t_body)
+{
+	const int repeatsPerRun = t_repeats / 5 > 0 ? t_repeats / 5 : 1; // calls timed together
+
+	const float best = bestOf(5, [&]()
+	{
+		for (int repeat = 0; repeat < repeatsPerRun; repeat++)
+		{
+			t_body();
+		}
+	});
+
+	return best * 1000.0f / (t_count * repeatsPerRun);
+}
+
+
+/// normalize, length, dot, rotate and distance squared over 100k vectors
+/// first with the one vector at a time VectorFormulas, then every batch path the cpu supports
+void benchmarkVectorBatch()
+{
+	const std::size_t count = 100000u; // vectors per call
+	const int repeats = 100; // calls timed per kernel
+	std::vector<sf::Vector2f> vectorsA(count); // first input
+	std::vector<sf::Vector2f> vectorsB(count); // second input for dot product
+	std::vector<sf::Vector2f> vectorOut(count); // vector results
+	std::vector<float> floatOut(count); // scalar results
+	const sf::Vector2f point{ 400.0f, 300.0f }; // point distances are measured to
+	Random random{ 1u }; // same vectors every run
+
+	for (std::size_t i = 0u; i < count; i++)
+	{
+		vectorsA[i] = sf::Vector2f{ static_cast<float>(random.nextInt(800)), static_cast<float>(random.nextInt(600)) };
+		vectorsB[i] = sf::Vector2f{ static_cast<float>(random.nextInt(800)), static_cast<float>(random.nextInt(600)) };
+	}
+
+	const char * kernels[] = { "normalize", "length", "dot", "rotate", "distance_squared" }; // result names, in timing order
+	float times[5]; // ns per vector of each kernel on the path being measured
+
+	// prints and records the five kernel timings of one path
+	auto report = [&](const std::string & t_path)
+	{
+		std::cout << "  " << t_path << ": ";
+		for (int kernel = 0; kernel < 5; kernel++)
+		{
+			std::cout << times[kernel] << (kernel < 4 ? ", " : "\n");
+			recordResult("vector/" + std::string{ kernels[kernel] } + "/" + t_path, times[kernel], "ns");
+		}
+	};
+
+	std::cout << "vector formulas, ns per vector: normalize, length, dot, rotate, distance squared" << std::endl;
+
+	times[0] = nanosecondsPerVector(count, repeats, [&]() { for (std::size_t i = 0u; i < count; i++) vectorOut[i] = vectorUnitVector(vectorsA[i]); });
+	times[1] = nanosecondsPerVector(count, repeats, [&]() { for (std::size_t i = 0u; i < count; i++) floatOut[i] = vectorLength(vectorsA[i]); });
+	times[2] = nanosecondsPerVector(count, repeats, [&]() { for (std::size_t i = 0u; i < count; i++) floatOut[i] = vectorDotProduct(vectorsA[i], vectorsB[i]); });
+	times[3] = nanosecondsPerVector(count, repeats, [&]() { for (std::size_t i = 0u; i < count; i++) vectorOut[i] = vectorRotateBy(vectorsA[i], 0.5f); });
+	times[4] = nanosecondsPerVector(count, repeats, [&]() { for (std::size_t i = 0u; i < count; i++) floatOut[i] = vectorLengthSquared(vectorsA[i] - point); });
+	report("one_at_a_time");
+
+	const VectorBatchPath bestPath = vectorBatchPath(); // restored afterwards
+	const VectorBatchPath paths[] = { VectorBatchPath::scalar, VectorBatchPath::sse, VectorBatchPath::avx };
+
+	for (VectorBatchPath path : paths)
+	{
+		if (!setVectorBatchPath(path)) // cpu does not support this path
+		{
+			continue;
+		}
+
+		times[0] = nanosecondsPerVector(count, repeats, [&]() { vectorUnitVectorBatch(vectorsA.data(), vectorOut.data(), count); });
+		times[1] = nanosecondsPerVector(count, repeats, [&]() { vectorLengthBatch(vectorsA.data(), floatOut.data(), count); });
+		times[2] = nanosecondsPerVector(count, repeats, [&]() { vectorDotProductBatch(vectorsA.data(), vectorsB.data(), floatOut.data(), count); });
+		times[3] = nanosecondsPerVector(count, repeats, [&]() { vectorRotateByBatch(vectorsA.data(), 0.5f, vectorOut.data(), count); });
+		times[4] = nanosecondsPerVector(count, repeats, [&]() { vectorDistanceSquaredBatch(vectorsA.data(), point, floatOut.data(), count); });
+		report("batch_" + std::string{ vectorBatchPathName(path) });
+	}
+
+	setVectorBatchPath(bestPath);
+}
+
+
+/// update loop style vector maths over 100k asteroids, direction, move and explosion distance check
+/// out of line version calls through pointers the compiler cannot see through, like the old VectorFormulas.cpp
+/// inlined version calls the header functions directly so they fold into the loop
+void benchmarkVectorInlining()
+{
+	const std::size_t count = 100000u; // asteroids per tick
+	const int ticks = 100; // ticks timed per version
+	std::vector<sf::Vector2f> starts(count); // asteroid start points
+	std::vector<sf::Vector2f> tips(count); // asteroid tips
+	const sf::Vector2f explosion{ 400.0f, 300.0f }; // explosion centre
+	std::size_t hits = 0u; // keeps results alive so the loops are not optimised away
+	Random random{ 1u }; // same asteroids every run
+
+	for (std::size_t i = 0u; i < count; i++)
+	{
+		starts[i] = sf::Vector2f{ static_cast<float>(random.nextInt(800)), 0.0f };
+		tips[i] = sf::Vector2f{ static_cast<float>(random.nextInt(800)), static_cast<float>(random.nextInt(600)) };
+	}
+
+	// volatile pointers, compiler must make a real call every time
+	sf::Vector2f(*volatile unitVector)(sf::Vector2f) = &vectorUnitVector<float>;
+	float(*volatile lengthSquared)(sf::Vector2f) = &vectorLengthSquared<float>;
+
+	const float outOfLine = nanosecondsPerVector(count, ticks, [&]()
+	{
+		for (std::size_t i = 0u; i < count; i++)
+		{
+			const sf::Vector2f velocity = unitVector(tips[i] - starts[i]) * 0.2f;
+			hits += lengthSquared(tips[i] + velocity - explosion) < 900.0f ? 1u : 0u;
+		}
+	});
+
+	const float inlined = nanosecondsPerVector(count, ticks, [&]()
+	{
+		for (std::size_t i = 0u; i < count; i++)
+		{
+			const sf::Vector2f velocity = vectorUnitVector(tips[i] - starts[i]) * 0.2f;
+			hits += vectorLengthSquared(tips[i] + velocity - explosion) < 900.0f ? 1u : 0u;
+		}
+	});
+
+	std::cout << "vector inlining, ns per asteroid: out of line " << outOfLine << ", inlined " << inlined
+		<< " (" << hits << " hits)" << std::endl;
+	recordResult("vector_inlining/out_of_line", outOfLine, "ns");
+	recordResult("vector_inlining/inlined", inlined, "ns");
+}
+
+
+/// stress test waves of 100, 1k and 10k asteroids, four lasers fired every tick so explosions are always alive
+/// a second of warm up fills the laser pool, then 300 ticks are timed, best of three runs is kept
+void benchmarkSimulationUpdate()
+{
+	const unsigned waveSizes[] = { 100u, 1000u, 10000u }; // asteroids per wave
+	const sf::Time timePerTick = sf::seconds(1.0f / 60.0f); // 60 fps
+	const int ticks = 300; // ticks timed per run
+
+	for (unsigned waveSize : waveSizes)
+	{
+		float best = 0.0f; // fastest run, us per tick
+
+		for (int run = 0; run < 3; run++)
+		{
+			Simulation simulation{ waveSize, true, 1u }; // same waves and shots every run
+
+			for (int tick = 0; tick < 60; tick++)
+			{
+				simulation.update(timePerTick);
+			}
+
+			sf::Clock clock;
+			for (int tick = 0; tick < ticks; tick++)
+			{
+				simulation.update(timePerTick);
+			}
+			const float perTick = static_cast<float>(clock.getElapsedTime().asMicroseconds()) / ticks; // us per tick
+
+			best = run == 0 ? perTick : std::min(best, perTick);
+		}
+
+		std::cout << "simulation update with " << waveSize << " asteroids: " << best << " us per tick" << std::endl;
+		recordResult("simulation_update/" + std::to_string(waveSize), best, "us");
+	}
+}
+
+
+/// HUD text of a number that changes every frame and of one that does not
+/// HudValue formats into its fixed buffer only on change, the old HUD built a std::string every frame
+void benchmarkHud()
+{
+	const int frames = 200000; // HUD updates per run, best of five runs is kept
+	HudValue score{ "Score: ", "pts" }; // same text as the game's score
+	std::size_t length = 0u; // keeps results alive so the loops are not optimised away
+
+	const float changed = bestOf(5, [&]()
+	{
+		for (int frame = 0; frame < frames; frame++)
+		{
+			score.set(frame);
+			length += score.text()[7];
+		}
+	}) * 1000.0f / frames; // ns per update
+
+	const float unchanged = bestOf(5, [&]()
+	{
+		for (int frame = 0; frame < frames; frame++)
+		{
+			length += score.set(12) ? 1u : 0u;
+		}
+	}) * 1000.0f / frames; // ns per update
+
+	const float rebuilt = bestOf(5, [&]()
+	{
+		for (int frame = 0; frame < frames; frame++)
+		{
+			const std::string text = "Score: " + std::to_string(frame) + "pts"; // old HUD, rebuilt every frame
+			length += text.size();
+		}
+	}) * 1000.0f / frames; // ns per update
+
+	std::cout << "hud, ns per update: changed " << changed << ", unchanged " << unchanged
+		<< ", std::string every frame " << rebuilt << " (" << length << ")" << std::endl;
+	recordResult("hud/changed", changed, "ns");
+	recordResult("hud/unchanged", unchanged, "ns");
+	recordResult("hud/string_every_frame", rebuilt, "ns");
+}
+
+
+/// one stress test frame as Game draws it: update, snapshot, then the Scene drawn to an offscreen texture
+/// waves of 100, 1k and 10k asteroids, a second of warm up then 300 frames timed
+void benchmarkFrame()
+{
+	const unsigned waveSizes[] = { 100u, 1000u, 10000u }; // asteroids per wave
+	const sf::Time timePerTick = sf::seconds(1.0f / 60.0f); // 60 fps
+	const int frames = 300; // frames timed per wave size
+
+	sf::RenderTexture target; // offscreen target so vsync does not hide draw cost
+	if (!target.create(800u, 600u))
+	{
+		std::cout << "problem creating render texture for frame benchmark" << std::endl;
+		return;
+	}
+
+	ResourceCache resources{ false, Scene::assets() }; // font and logo, like Game's
+	resources.waitForPreload();
+	Scene scene{ resources }; // same screens the window draws
+	FrameArena arena; // vertices of one frame, like Game's
+
+	for (unsigned waveSize : waveSizes)
+	{
+		Simulation simulation{ waveSize, true, 1u }; // same waves and shots every run
+		Snapshot snapshot; // state drawn each frame
+		sf::Clock clock;
+
+		for (int frame = -60; frame < frames; frame++)
+		{
+			if (frame == 0) // warm up over, vectors are at full size
+			{
+				clock.restart();
+			}
+
+			arena.reset();
+			simulation.update(timePerTick);
+			snapshot.capture(simulation);
+			scene.draw(target, snapshot, arena);
+			target.display();
+		}
+		const float perFrame = static_cast<float>(clock.getElapsedTime().asMicroseconds()) / frames; // us per frame
+
+		std::cout << "frame with " << waveSize << " asteroids: " << perFrame << " us" << std::endl;
+		recordResult("frame/" + std::to_string(waveSize), perFrame, "us");
+	}
+}
+
+
+/// runs the simulation thread for two seconds per case while a fake renderer takes snapshots
+/// like Game::runThreaded and then sleeps, the simulation must keep ticking 60 times a second
+void benchmarkSimulationThread()
+{
+	const int renderDelays[] = { 0, 50, 200 }; // milliseconds every fake frame takes
+	const sf::Time timePerTick = sf::seconds(1.f / 60.0f); // 60 fps
+	const sf::Time duration = sf::seconds(2.0f); // run time per case
+
+	for (int renderDelay : renderDelays)
+	{
+		Simulation simulation{ 1000u, false, 1u }; // big wave so every tick does some work
+		InputRecorder recorder; // never opened
+		SimulationThread simulationThread{ simulation, recorder, nullptr, timePerTick }; // nothing plays, the wave just falls
+		Snapshot previous; // second newest snapshot
+		Snapshot current; // newest snapshot
+		unsigned frames = 0u; // fake frames drawn
+
+		simulation.setGameState(Simulation::classicMode);
+		simulationThread.start();
+
+		sf::Clock clock;
+		while (clock.getElapsedTime() < duration)
+		{
+			if (simulationThread.snapshots().acquire())
+			{
+				previous = current;
+				current = simulationThread.snapshots().front();
+			}
+
+			frames++;
+			sf::sleep(sf::milliseconds(renderDelay)); // frame being drawn
+		}
+
+		simulationThread.stop();
+		const float seconds = clock.getElapsedTime().asSeconds(); // whole run, including the last frame
+
+		std::cout << "simulation thread, render " << renderDelay << " ms per frame: "
+			<< simulationThread.ticks() / seconds << " ticks per second, " << frames / seconds << " frames per second, "
+			<< "last snapshot tick " << current.tick << std::endl;
+		recordResult("simulation_thread/render_" + std::to_string(renderDelay) + "ms", simulationThread.ticks() / seconds, "ticks/s", true);
+	}
+}
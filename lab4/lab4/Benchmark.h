@@ -0,0 +1,42 @@
+// Author: Michal K.
+
+#ifndef BENCHMARK
+#define BENCHMARK
+
+#include <string>
+
+// runs all benchmarks and prints their results, started with the --benchmark command line argument
+// with a results path every measurement is also written there, see writeBenchmarkResults()
+void runBenchmarks(const std::string & t_resultsPath);
+
+// every measurement recorded so far as json, compared against a stored baseline by benchmarks/compare_benchmarks.py
+bool writeBenchmarkResults(const std::string & t_path);
+
+// full 600 pixel asteroid descent, compares appending vertices every tick against setTrail()
+void benchmarkTrail();
+
+// spawn and integration cost of asteroid waves of growing size, cost per asteroid must stay flat
+void benchmarkAsteroidWave();
+
+// explosion vs asteroid collisions, brute force all pairs against the CollisionGrid broad phase
+void benchmarkCollision();
+
+// batch VectorFormulas kernels on every path the cpu supports against the one vector at a time functions
+void benchmarkVectorBatch();
+
+// update loop style vector maths called out of line through pointers against the inlined header functions
+void benchmarkVectorInlining();
+
+// whole Simulation::update, collisionDetection included, in stress test with waves of 100, 1k and 10k asteroids
+void benchmarkSimulationUpdate();
+
+// HudValue formatting of a changed and an unchanged number against building a std::string every frame
+void benchmarkHud();
+
+// update, snapshot and Scene drawn to an offscreen texture with 100, 1k and 10k asteroids, one full frame
+void benchmarkFrame();
+
+// simulation thread tick rate while a fake renderer takes 0, 50 and 200 ms per frame, must stay at 60
+void benchmarkSimulationThread();
+
+#endif // !BENCHMARK
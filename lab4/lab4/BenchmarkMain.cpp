@@ -0,0 +1,16 @@
+// Author: Michal K.
+
+// entry point of the lab4_benchmark executable of the CMake build
+// the Visual Studio project runs the same benchmarks with lab4 --benchmark
+
+#include "Benchmark.h"
+#include "Options.h"
+
+
+/// runs every benchmark and prints the results
+/// --benchmark-out <file> also writes them as json for benchmarks/compare_benchmarks.py
+int main(int argc, char * argv[])
+{
+	runBenchmarks(parseOptions(argc, argv).benchmarkPath);
+	return 0;
+}
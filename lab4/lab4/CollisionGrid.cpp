@@ -0,0 +1,100 @@
+// Author: Michal K.
+
+#include "CollisionGrid.h"
+#include <algorithm>
+#include <cmath>
+#include "VectorBatch.h"
+
+
+/// grid covering t_width by t_height split into square cells
+/// cell size should be at least the largest circle radius so a circle overlaps few cells
+CollisionGrid::CollisionGrid(float t_width, float t_height, float t_cellSize) :
+	m_cellSize{ t_cellSize },
+	m_columns{ std::max(1, static_cast<int>(std::ceil(t_width / t_cellSize))) },
+	m_rows{ std::max(1, static_cast<int>(std::ceil(t_height / t_cellSize))) }
+{
+	m_cellStart.resize(static_cast<std::size_t>(m_columns * m_rows) + 1u);
+}
+
+
+/// buckets points into cells with a counting sort
+/// first pass counts points per cell, second pass writes each index to its cell's range
+void CollisionGrid::build(const sf::Vector2f * t_points, std::size_t t_count)
+{
+	m_pointCell.resize(t_count);
+	m_sortedPoints.resize(t_count);
+	m_sortedPositions.resize(t_count);
+	m_distancesSquared.resize(t_count);
+	std::fill(m_cellStart.begin(), m_cellStart.end(), 0u);
+
+	for (std::size_t i = 0u; i < t_count; i++) // count points per cell
+	{
+		const int cell = cellRow(t_points[i].y) * m_columns + cellColumn(t_points[i].x);
+		m_pointCell[i] = cell;
+		m_cellStart[cell + 1]++;
+	}
+
+	for (std::size_t cell = 1u; cell < m_cellStart.size(); cell++) // prefix sum gives start of each cell
+	{
+		m_cellStart[cell] += m_cellStart[cell - 1u];
+	}
+
+	for (std::size_t i = 0u; i < t_count; i++) // cell start used as write cursor, shifted back afterwards
+	{
+		const std::size_t entry = m_cellStart[m_pointCell[i]]++;
+		m_sortedPoints[entry] = i;
+		m_sortedPositions[entry] = t_points[i];
+	}
+
+	for (std::size_t cell = m_cellStart.size() - 1u; cell > 0u; cell--) // undo cursor shift
+	{
+		m_cellStart[cell] = m_cellStart[cell - 1u];
+	}
+	m_cellStart[0] = 0u;
+}
+
+
+/// indices of bucketed points strictly inside circle, appended to t_hits
+/// only cells overlapping circle's bounding box are visited, narrow phase compares squared distances
+/// squared distances of a whole run of cells are worked out in one batch
+void CollisionGrid::queryCircle(sf::Vector2f t_center, float t_radius, std::vector<std::size_t> & t_hits) const
+{
+	const int firstColumn = cellColumn(t_center.x - t_radius);
+	const int lastColumn = cellColumn(t_center.x + t_radius);
+	const int firstRow = cellRow(t_center.y - t_radius);
+	const int lastRow = cellRow(t_center.y + t_radius);
+	const float radiusSquared = t_radius * t_radius; // compared against squared distance, no sqrt needed
+
+	for (int row = firstRow; row <= lastRow; row++)
+	{
+		// cells of one row are next to each other, so the whole column range is one run of points
+		const std::size_t first = m_cellStart[row * m_columns + firstColumn];
+		const std::size_t last = m_cellStart[row * m_columns + lastColumn + 1];
+
+		vectorDistanceSquaredBatch(m_sortedPositions.data() + first, t_center, m_distancesSquared.data() + first, last - first);
+
+		for (std::size_t entry = first; entry < last; entry++)
+		{
+			if (m_distancesSquared[entry] < radiusSquared)
+			{
+				t_hits.push_back(m_sortedPoints[entry]);
+			}
+		}
+	}
+}
+
+
+/// column of cell containing x, clamped to grid
+int CollisionGrid::cellColumn(float t_x) const
+{
+	const int column = static_cast<int>(std::floor(t_x / m_cellSize));
+	return std::min(std::max(column, 0), m_columns - 1);
+}
+
+
+/// row of cell containing y, clamped to grid
+int CollisionGrid::cellRow(float t_y) const
+{
+	const int row = static_cast<int>(std::floor(t_y / m_cellSize));
+	return std::min(std::max(row, 0), m_rows - 1);
+}
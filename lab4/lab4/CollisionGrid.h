@@ -0,0 +1,38 @@
+// Author: Michal K.
+
+#ifndef COLLISION_GRID
+#define COLLISION_GRID
+
+#include <SFML/System.hpp>
+#include <vector>
+
+// uniform grid over the playfield used as broad phase for point vs circle collisions
+// points are bucketed once per tick with a counting sort, circles only test points in the cells they overlap
+// every buffer is reused, nothing is allocated once the grid has seen its largest point count
+class CollisionGrid
+{
+public:
+	CollisionGrid(float t_width, float t_height, float t_cellSize);
+
+	// buckets t_count points into cells, points outside the playfield go into the nearest border cell
+	void build(const sf::Vector2f * t_points, std::size_t t_count);
+
+	// indices of bucketed points strictly inside circle, appended to t_hits
+	void queryCircle(sf::Vector2f t_center, float t_radius, std::vector<std::size_t> & t_hits) const;
+
+private:
+	int cellColumn(float t_x) const; // column of cell containing x, clamped to grid
+	int cellRow(float t_y) const; // row of cell containing y, clamped to grid
+
+	float m_cellSize; // width and height of one cell
+	int m_columns; // number of cells across
+	int m_rows; // number of cells down
+
+	std::vector<std::size_t> m_cellStart; // first entry of each cell in m_sortedPoints, one extra for end
+	std::vector<std::size_t> m_sortedPoints; // point indices sorted by cell
+	std::vector<sf::Vector2f> m_sortedPositions; // point positions sorted by cell, so a cell run is contiguous
+	mutable std::vector<float> m_distancesSquared; // narrow phase results of a query, sized by build()
+	std::vector<int> m_pointCell; // cell of each point, saves recalculating it in second pass
+};
+
+#endif // !COLLISION_GRID
@@ -0,0 +1,114 @@
+// Author: Michal K.
+
+#ifndef COMPONENT_POOL
+#define COMPONENT_POOL
+
+#include <vector>
+#include <cstdint>
+
+typedef std::uint32_t Entity; // id of one game object, it is nothing but the components stored under it
+const Entity NO_ENTITY = 0xFFFFFFFFu; // id no entity ever gets
+
+// every component of one type packed into one array, a sparse set
+// m_indices maps an entity to the place of its component, removing moves the last component into the gap
+// so the array never has holes and a system walking it reads one contiguous block
+template <typename T>
+class ComponentPool
+{
+public:
+	T & add(Entity t_entity, const T & t_component); // gives the entity this component, replaces the one it had
+	void remove(Entity t_entity); // takes the component away from the entity, if it has one
+	void clear(); // removes every component, memory is kept
+	void reserve(std::size_t t_count); // room for t_count components without allocating
+
+	bool has(Entity t_entity) const { return t_entity < m_indices.size() && m_indices[t_entity] != NONE; }
+	T & get(Entity t_entity) { return m_components[m_indices[t_entity]]; } // entity must have one
+	const T & get(Entity t_entity) const { return m_components[m_indices[t_entity]]; } // entity must have one
+
+	std::size_t size() const { return m_components.size(); } // number of entities with this component
+	bool empty() const { return m_components.empty(); }
+	T & operator[](std::size_t t_index) { return m_components[t_index]; } // component by place in the pool
+	const T & operator[](std::size_t t_index) const { return m_components[t_index]; } // component by place in the pool
+	Entity entity(std::size_t t_index) const { return m_entities[t_index]; } // owner of component by place in the pool
+
+private:
+	static const std::uint32_t NONE = 0xFFFFFFFFu; // entity has no component in this pool
+
+	std::vector<T> m_components; // packed components, in no particular order
+	std::vector<Entity> m_entities; // owner of each component
+	std::vector<std::uint32_t> m_indices; // place of each entity's component, NONE if it has none
+};
+
+template <typename T>
+const std::uint32_t ComponentPool<T>::NONE;
+
+
+/// gives the entity this component, the pool grows only the first time an id this high is seen
+template <typename T>
+T & ComponentPool<T>::add(Entity t_entity, const T & t_component)
+{
+	if (has(t_entity))
+	{
+		T & component = get(t_entity);
+		component = t_component;
+		return component;
+	}
+
+	if (t_entity >= m_indices.size())
+	{
+		m_indices.resize(t_entity + 1u, NONE);
+	}
+
+	m_indices[t_entity] = static_cast<std::uint32_t>(m_components.size());
+	m_entities.push_back(t_entity);
+	m_components.push_back(t_component);
+	return m_components.back();
+}
+
+
+/// last component takes the removed one's place, so removing while walking the pool backwards is safe
+template <typename T>
+void ComponentPool<T>::remove(Entity t_entity)
+{
+	if (!has(t_entity))
+	{
+		return;
+	}
+
+	const std::uint32_t index = m_indices[t_entity]; // gap left by the component
+	const Entity last = m_entities.back(); // owner of the component moved into the gap
+
+	m_components[index] = m_components.back();
+	m_entities[index] = last;
+	m_indices[last] = index;
+	m_indices[t_entity] = NONE;
+
+	m_components.pop_back();
+	m_entities.pop_back();
+}
+
+
+/// removes every component, memory is kept for the next game
+template <typename T>
+void ComponentPool<T>::clear()
+{
+	for (Entity entity : m_entities)
+	{
+		m_indices[entity] = NONE;
+	}
+
+	m_components.clear();
+	m_entities.clear();
+}
+
+
+/// room for t_count components, ids up to t_count do not grow the index either
+template <typename T>
+void ComponentPool<T>::reserve(std::size_t t_count)
+{
+	m_components.reserve(t_count);
+	m_entities.reserve(t_count);
+	m_indices.reserve(t_count);
+}
+
+#endif // !COMPONENT_POOL
@@ -0,0 +1,52 @@
+// Author: Michal K.
+
+#ifndef COMPONENTS
+#define COMPONENTS
+
+#include <SFML/System.hpp>
+#include <cstdint>
+
+// data an entity can have, each type lives in its own ComponentPool of the World
+// an entity type is only the set of components it is made of, see World::spawnAsteroids() and World::spawnLaser()
+
+// where a projectile came from and where its tip is now
+struct Transform
+{
+	sf::Vector2f startPoint{ 0.0f, 0.0f }; // start of the trail, the base for lasers
+	sf::Vector2f tipPoint{ 0.0f, 0.0f }; // moved every tick by the velocity
+};
+
+// straight line movement
+struct Velocity
+{
+	sf::Vector2f perSecond{ 0.0f, 0.0f }; // pixels per second in the direction of travel
+};
+
+// how a laser's life runs out, its flight stops at a height and its explosion at a radius
+struct Lifetime
+{
+	enum Stage : std::uint8_t { flight, explosion }; // all possible stages of a laser
+
+	float stopHeight = 0.0f; // flight ends once the tip climbs to this height
+	Stage stage = flight; // current stage
+};
+
+// what an entity can hit, asteroids are a point at their tip and explosions a circle around theirs
+struct Collider
+{
+	enum Layer : std::uint8_t { asteroid, explosion }; // explosions shoot down asteroids
+
+	Layer layer = asteroid;
+	float radius = 0.0f; // grows while an explosion is alive
+	float bornAt = 0.0f; // fraction of the tick an explosion appeared at, zero once it has grown a whole tick
+};
+
+// how an entity is drawn
+struct Renderable
+{
+	enum Shape : std::uint8_t { trail, ring }; // line from start point to tip, or circle outline around the tip
+
+	Shape shape = trail;
+};
+
+#endif // !COMPONENTS
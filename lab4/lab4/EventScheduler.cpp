@@ -0,0 +1,46 @@
+// Author: Michal K.
+
+#include "EventScheduler.h"
+#include <algorithm>
+
+
+/// heap ordering, std heap functions keep the largest at the front so later events compare greater
+static bool laterEvent(const EventScheduler::Event & t_left, const EventScheduler::Event & t_right)
+{
+	return t_left.time > t_right.time || (t_left.time == t_right.time && t_left.order > t_right.order);
+}
+
+
+/// room for an arrival and an explosion end per laser plus the wave events
+EventScheduler::EventScheduler()
+{
+	m_heap.reserve(256u);
+}
+
+
+/// adds an event to the heap
+/// <param name="t_time">game time in seconds</param>
+/// <param name="t_type">what happens</param>
+void EventScheduler::schedule(double t_time, Type t_type)
+{
+	m_heap.push_back(Event{ t_time, t_type, m_order++ });
+	std::push_heap(m_heap.begin(), m_heap.end(), laterEvent);
+}
+
+
+/// removes and returns the earliest event
+EventScheduler::Event EventScheduler::pop()
+{
+	std::pop_heap(m_heap.begin(), m_heap.end(), laterEvent);
+	const Event earliest = m_heap.back(); // moved to the back by pop_heap
+	m_heap.pop_back();
+
+	return earliest;
+}
+
+
+/// forgets every event, capacity is kept
+void EventScheduler::clear()
+{
+	m_heap.clear();
+}
@@ -0,0 +1,37 @@
+// Author: Michal K.
+
+#ifndef EVENT_SCHEDULER
+#define EVENT_SCHEDULER
+
+#include <cstdint>
+#include <vector>
+
+// game time events worked out in advance, kept in a min-heap so the next one is always at the front
+// trajectories are straight lines so impact and arrival times are known as soon as something is launched
+class EventScheduler
+{
+public:
+	enum Type : std::uint8_t { groundImpact, laserArrival, explosionEnd, waveLaunch }; // all possible events
+
+	struct Event
+	{
+		double time; // game time in seconds the event happens at
+		Type type; // what happens
+		std::uint64_t order; // events at the same time come out in the order they were scheduled
+	};
+
+	EventScheduler();
+
+	void schedule(double t_time, Type t_type); // adds an event, no allocation below the reserved capacity
+	Event pop(); // removes and returns the earliest event, queue must not be empty
+	void clear(); // forgets every event, capacity is kept
+
+	bool empty() const { return m_heap.empty(); } // no events scheduled
+	const Event & next() const { return m_heap.front(); } // earliest event, queue must not be empty
+
+private:
+	std::vector<Event> m_heap; // min-heap on time then order
+	std::uint64_t m_order = 0u; // order given to the next scheduled event
+};
+
+#endif // !EVENT_SCHEDULER
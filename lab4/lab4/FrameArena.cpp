@@ -0,0 +1,87 @@
+// Author: Michal K.
+
+#include "FrameArena.h"
+#include <algorithm>
+#include <cstdint>
+#include <new>
+
+
+/// the first block is allocated up front, not in the middle of a frame
+/// <param name="t_blockSize">bytes of the first block and of every block added when nothing fits</param>
+FrameArena::FrameArena(std::size_t t_blockSize) :
+	m_blockSize{ t_blockSize }
+{
+	m_blocks.reserve(8u);
+	addBlock(m_blockSize);
+}
+
+
+/// returns every block to the heap
+FrameArena::~FrameArena()
+{
+	for (Block & block : m_blocks)
+	{
+		::operator delete(block.memory);
+	}
+}
+
+
+/// next t_bytes of the current block, or of the first later block they fit in
+/// a block is added only if none fits, blocks skipped stay unused until reset()
+void * FrameArena::allocate(std::size_t t_bytes, std::size_t t_alignment)
+{
+	while (true)
+	{
+		for (; m_block < m_blocks.size(); m_block++, m_offset = 0u)
+		{
+			const Block & block = m_blocks[m_block];
+			const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(block.memory) + m_offset; // next free byte
+			const std::size_t padding = static_cast<std::size_t>((t_alignment - address % t_alignment) % t_alignment);
+
+			if (m_offset + padding + t_bytes <= block.size)
+			{
+				void * memory = block.memory + m_offset + padding;
+				m_offset += padding + t_bytes;
+				m_used += padding + t_bytes;
+				return memory;
+			}
+		}
+
+		addBlock(std::max(m_blockSize, t_bytes + t_alignment)); // big enough for any alignment
+	}
+}
+
+
+/// everything is free again
+/// if the frame needed more than one block they are replaced by one block as big as all of them,
+/// so the next frame like it runs from one block and allocates nothing
+void FrameArena::reset()
+{
+	if (m_blocks.size() > 1u)
+	{
+		const std::size_t merged = m_capacity; // bytes of every block together
+
+		for (Block & block : m_blocks)
+		{
+			::operator delete(block.memory);
+		}
+
+		m_blocks.clear();
+		m_capacity = 0u;
+		addBlock(merged);
+	}
+
+	m_block = 0u;
+	m_offset = 0u;
+	m_used = 0u;
+}
+
+
+/// new block at the end of the list, filling carries on from its start
+void FrameArena::addBlock(std::size_t t_size)
+{
+	m_blocks.push_back(Block{ static_cast<char *>(::operator new(t_size)), t_size });
+	m_capacity += t_size;
+	m_block = m_blocks.size() - 1u;
+	m_offset = 0u;
+}
@@ -0,0 +1,89 @@
+// Author: Michal K.
+
+#ifndef FRAME_ARENA
+#define FRAME_ARENA
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// bump allocator for data that only lives for one frame or one tick
+// allocate() hands out the next bytes of the current block, reset() frees everything at once
+// the heap is only used while the arena grows to its busiest frame, after that never
+// a frame that spilled over several blocks has them merged into one on the next reset()
+class FrameArena
+{
+public:
+	static const std::size_t DEFAULT_BLOCK_SIZE = 64u * 1024u; // bytes of the first block
+
+	explicit FrameArena(std::size_t t_blockSize = DEFAULT_BLOCK_SIZE);
+	~FrameArena();
+
+	FrameArena(const FrameArena &) = delete;
+	FrameArena & operator=(const FrameArena &) = delete;
+
+	void * allocate(std::size_t t_bytes, std::size_t t_alignment); // t_alignment must be a power of two
+	void reset(); // everything handed out since the last reset is free again, memory is kept
+
+	// constructs a T in the arena, its destructor never runs so a T may only own memory from this arena
+	template <typename T, typename... Args>
+	T * create(Args &&... t_args) { return new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(t_args)...); }
+
+	std::size_t bytesUsed() const { return m_used; } // handed out since the last reset, padding included
+	std::size_t capacity() const { return m_capacity; } // bytes of every block together
+
+private:
+	struct Block
+	{
+		char * memory; // from global operator new
+		std::size_t size; // bytes in memory
+	};
+
+	void addBlock(std::size_t t_size); // new block at the end, becomes the current block
+
+	std::vector<Block> m_blocks; // in the order they are filled
+	std::size_t m_block = 0u; // block being filled
+	std::size_t m_offset = 0u; // bytes of the current block handed out
+	std::size_t m_used = 0u; // bytes handed out since the last reset
+	std::size_t m_capacity = 0u; // bytes of every block together
+	std::size_t m_blockSize; // smallest block added when nothing fits
+};
+
+
+// standard allocator handing out memory from a FrameArena, deallocate() does nothing
+// stands in for std::pmr::polymorphic_allocator, the project builds as C++14 where std::pmr does not exist yet
+template <typename T>
+class ArenaAllocator
+{
+public:
+	typedef T value_type;
+	typedef std::true_type propagate_on_container_copy_assignment; // containers follow the arena they are given
+	typedef std::true_type propagate_on_container_move_assignment;
+	typedef std::true_type propagate_on_container_swap;
+
+	ArenaAllocator(FrameArena & t_arena) : m_arena(&t_arena) {}
+	template <typename U>
+	ArenaAllocator(const ArenaAllocator<U> & t_other) : m_arena(t_other.arena()) {}
+
+	T * allocate(std::size_t t_count) { return static_cast<T *>(m_arena->allocate(t_count * sizeof(T), alignof(T))); }
+	void deallocate(T *, std::size_t) {} // freed all at once by FrameArena::reset()
+
+	FrameArena * arena() const { return m_arena; }
+
+private:
+	FrameArena * m_arena; // memory comes from here
+};
+
+template <typename T, typename U>
+bool operator==(const ArenaAllocator<T> & t_left, const ArenaAllocator<U> & t_right) { return t_left.arena() == t_right.arena(); }
+
+template <typename T, typename U>
+bool operator!=(const ArenaAllocator<T> & t_left, const ArenaAllocator<U> & t_right) { return t_left.arena() != t_right.arena(); }
+
+// vector that lives in a FrameArena, only valid until the arena's next reset()
+template <typename T>
+using FrameVector = std::vector<T, ArenaAllocator<T>>;
+
+#endif // !FRAME_ARENA
@@ -0,0 +1,346 @@
+// Author: Michal K.
+
+#include "GlyphAtlas.h"
+#include <algorithm>
+#include <cmath>
+
+const std::size_t AtlasText::RESERVED_CHARACTERS; // std::max() takes it by reference
+
+/// glyph of a baked character
+/// <returns>null for a character the face was not asked for</returns>
+const GlyphAtlas::Glyph * GlyphAtlas::Face::glyph(char t_character) const
+{
+	if (t_character < FIRST_CHARACTER || t_character > LAST_CHARACTER)
+	{
+		return nullptr;
+	}
+
+	const Glyph & found = glyphs[t_character - FIRST_CHARACTER];
+	return found.baked ? &found : nullptr;
+}
+
+
+/// kerning between two baked characters, as sf::Font::getKerning() gave it at build time
+float GlyphAtlas::Face::kerningOf(char t_first, char t_second) const
+{
+	if (t_first < FIRST_CHARACTER || t_first > LAST_CHARACTER || t_second < FIRST_CHARACTER || t_second > LAST_CHARACTER)
+	{
+		return 0.0f;
+	}
+
+	const std::uint16_t pair = static_cast<std::uint16_t>((t_first - FIRST_CHARACTER) * CHARACTER_COUNT + (t_second - FIRST_CHARACTER));
+	const auto found = std::lower_bound(kerning.begin(), kerning.end(), std::make_pair(pair, -1.0e9f));
+
+	return found != kerning.end() && found->first == pair ? found->second : 0.0f;
+}
+
+
+/// characters one face has to show, merged with any asked for before
+/// a space is always added, text uses its advance for every space
+/// <param name="t_characters">characters of the string, or every character a changing number can use</param>
+void GlyphAtlas::add(unsigned t_characterSize, bool t_bold, float t_outlineThickness, const std::string & t_characters)
+{
+	auto found = std::find_if(m_faces.begin(), m_faces.end(), [&](const Face & t_face)
+	{
+		return t_face.characterSize == t_characterSize && t_face.bold == t_bold && t_face.outlineThickness == t_outlineThickness;
+	});
+
+	if (found == m_faces.end())
+	{
+		Face face;
+		face.characterSize = t_characterSize;
+		face.bold = t_bold;
+		face.outlineThickness = t_outlineThickness;
+		face.characters = " ";
+		m_faces.push_back(face);
+		found = m_faces.end() - 1;
+	}
+
+	for (char character : t_characters)
+	{
+		if (character >= FIRST_CHARACTER && character <= LAST_CHARACTER && found->characters.find(character) == std::string::npos)
+		{
+			found->characters += character;
+		}
+	}
+}
+
+
+/// rasterises every face with sf::Font, then copies the glyphs from the font's pages into one texture
+/// rows of glyphs are packed tallest first, the top left corner is left opaque white
+/// <returns>false if the texture could not be created, text is then invisible</returns>
+bool GlyphAtlas::build(const sf::Font & t_font)
+{
+	struct Placement
+	{
+		Face * face; // glyph belongs to
+		char character;
+		sf::IntRect source; // in the font's page for the face's character size
+	};
+	std::vector<Placement> placements; // every glyph with pixels
+
+	for (Face & face : m_faces)
+	{
+		face.lineSpacing = t_font.getLineSpacing(face.characterSize);
+		face.underlineOffset = t_font.getUnderlinePosition(face.characterSize);
+		face.underlineThickness = t_font.getUnderlineThickness(face.characterSize);
+		face.kerning.clear();
+
+		for (char character : face.characters)
+		{
+			const sf::Glyph & glyph = t_font.getGlyph(static_cast<sf::Uint32>(character), face.characterSize, face.bold, face.outlineThickness);
+			Glyph & baked = face.glyphs[character - FIRST_CHARACTER];
+			baked.baked = true;
+			baked.advance = glyph.advance;
+			baked.bounds = glyph.bounds;
+
+			if (glyph.textureRect.width > 0 && glyph.textureRect.height > 0)
+			{
+				placements.push_back(Placement{ &face, character, glyph.textureRect });
+			}
+
+			for (char second : face.characters)
+			{
+				const float kerning = t_font.getKerning(static_cast<sf::Uint32>(character), static_cast<sf::Uint32>(second), face.characterSize);
+				if (kerning != 0.0f)
+				{
+					const std::uint16_t pair = static_cast<std::uint16_t>((character - FIRST_CHARACTER) * CHARACTER_COUNT + (second - FIRST_CHARACTER));
+					face.kerning.emplace_back(pair, kerning);
+				}
+			}
+		}
+
+		std::sort(face.kerning.begin(), face.kerning.end());
+	}
+
+	// tallest first so each row wastes little height
+	std::sort(placements.begin(), placements.end(), [](const Placement & t_left, const Placement & t_right)
+	{
+		return t_left.source.height > t_right.source.height;
+	});
+
+	unsigned x = WHITE_SIZE + PADDING; // next free column of the current row
+	unsigned y = 0u; // top of the current row
+	unsigned rowHeight = WHITE_SIZE; // tallest cell in the current row
+	for (Placement & placement : placements)
+	{
+		const unsigned cellWidth = static_cast<unsigned>(placement.source.width) + 2u * PADDING;
+		const unsigned cellHeight = static_cast<unsigned>(placement.source.height) + 2u * PADDING;
+
+		if (x + cellWidth > WIDTH) // next row
+		{
+			x = 0u;
+			y += rowHeight;
+			rowHeight = 0u;
+		}
+
+		placement.face->glyphs[placement.character - FIRST_CHARACTER].textureRect = sf::IntRect{
+			static_cast<int>(x + PADDING), static_cast<int>(y + PADDING), placement.source.width, placement.source.height };
+		x += cellWidth;
+		rowHeight = std::max(rowHeight, cellHeight);
+	}
+
+	sf::Image pixels; // transparent white like a font page, so smoothing does not darken edges
+	pixels.create(WIDTH, y + rowHeight, sf::Color{ 255u, 255u, 255u, 0u });
+
+	for (unsigned row = 0u; row < WHITE_SIZE; row++)
+	{
+		for (unsigned column = 0u; column < WHITE_SIZE; column++)
+		{
+			pixels.setPixel(column, row, sf::Color::White);
+		}
+	}
+
+	// one page per character size, read back from the graphics card once
+	std::vector<std::pair<unsigned, sf::Image>> pages;
+	for (const Placement & placement : placements)
+	{
+		const unsigned size = placement.face->characterSize;
+		auto page = std::find_if(pages.begin(), pages.end(), [size](const std::pair<unsigned, sf::Image> & t_page) { return t_page.first == size; });
+
+		if (page == pages.end())
+		{
+			pages.emplace_back(size, t_font.getTexture(size).copyToImage());
+			page = pages.end() - 1;
+		}
+
+		// the transparent pixel around the glyph comes along, text quads reach one pixel past the glyph
+		const sf::IntRect & target = placement.face->glyphs[placement.character - FIRST_CHARACTER].textureRect;
+		const sf::IntRect source{ placement.source.left - 1, placement.source.top - 1, placement.source.width + 2, placement.source.height + 2 };
+		pixels.copy(page->second, static_cast<unsigned>(target.left - 1), static_cast<unsigned>(target.top - 1), source);
+	}
+
+	if (!m_texture.loadFromImage(pixels))
+	{
+		return false;
+	}
+
+	m_texture.setSmooth(true); // like font pages, text is not always on whole pixels
+	return true;
+}
+
+
+/// face added with exactly these settings
+const GlyphAtlas::Face * GlyphAtlas::face(unsigned t_characterSize, bool t_bold, float t_outlineThickness) const
+{
+	for (const Face & face : m_faces)
+	{
+		if (face.characterSize == t_characterSize && face.bold == t_bold && face.outlineThickness == t_outlineThickness)
+		{
+			return &face;
+		}
+	}
+
+	return nullptr;
+}
+
+
+/// string is copied into the text's own buffer, vertices for it are reserved on the first call
+/// <param name="t_string">printable ASCII, characters the atlas was not given are left out</param>
+void AtlasText::setString(const char * t_string)
+{
+	const std::size_t length = std::char_traits<char>::length(t_string);
+	m_string.reserve(std::max(length, RESERVED_CHARACTERS));
+	m_string.assign(t_string, length);
+
+	const std::size_t characters = std::max(length, RESERVED_CHARACTERS) + 1u; // one more for the underline
+	m_vertices.reserve(characters * 12u); // fill and outline quads of every character
+	m_geometryNeedUpdate = true;
+}
+
+
+/// triangles of the text, rebuilt first if anything changed since the last call
+const std::vector<sf::Vertex> & AtlasText::vertices() const
+{
+	if (m_geometryNeedUpdate)
+	{
+		updateGeometry();
+		m_geometryNeedUpdate = false;
+	}
+
+	return m_vertices;
+}
+
+
+/// same layout as sf::Text: outline glyphs first, then the fill glyphs over them
+/// nothing is drawn if the atlas does not have the faces of this text
+void AtlasText::updateGeometry() const
+{
+	m_vertices.clear();
+
+	if (m_atlas == nullptr || m_string.empty())
+	{
+		return;
+	}
+
+	const GlyphAtlas::Face * fill = m_atlas->face(m_characterSize, isBold(), 0.0f);
+	const GlyphAtlas::Face * outline = m_outlineThickness != 0.0f ? m_atlas->face(m_characterSize, isBold(), m_outlineThickness) : nullptr;
+
+	if (fill == nullptr)
+	{
+		return;
+	}
+
+	if (outline != nullptr)
+	{
+		addGlyphs(*outline, m_outlineColor, m_outlineThickness);
+	}
+
+	addGlyphs(*fill, m_fillColor, 0.0f);
+}
+
+
+/// every character of the string as one quad of the face, with sf::Text's kerning, italic shear and underline
+/// <param name="t_outlineThickness">thickness of an outline face, its glyphs are moved back by it</param>
+void AtlasText::addGlyphs(const GlyphAtlas::Face & t_face, sf::Color t_color, float t_outlineThickness) const
+{
+	const float italicShear = (m_style & sf::Text::Italic) != 0u ? 0.209f : 0.0f; // 12 degrees
+	const GlyphAtlas::Glyph * space = t_face.glyph(' ');
+	const float spaceAdvance = space != nullptr ? space->advance : 0.0f;
+	const float padding = 1.0f; // quads reach one pixel past the glyph so smoothing does not cut its edges
+	float x = 0.0f; // pen position from the left of the text
+	float y = static_cast<float>(m_characterSize); // baseline of the current line
+	char previous = 0; // character before, for kerning
+
+	const bool underlined = (m_style & sf::Text::Underlined) != 0u;
+
+	for (char character : m_string)
+	{
+		x += t_face.kerningOf(previous, character);
+
+		if (underlined && character == '\n' && previous != '\n') // line ends, its underline goes with it
+		{
+			addUnderline(t_face, x, y, t_color, t_outlineThickness);
+		}
+		previous = character;
+
+		if (character == ' ')
+		{
+			x += spaceAdvance;
+			continue;
+		}
+
+		if (character == '\n')
+		{
+			y += t_face.lineSpacing;
+			x = 0.0f;
+			continue;
+		}
+
+		const GlyphAtlas::Glyph * glyph = t_face.glyph(character);
+		if (glyph == nullptr)
+		{
+			continue;
+		}
+
+		const float left = glyph->bounds.left - padding;
+		const float top = glyph->bounds.top - padding;
+		const float right = glyph->bounds.left + glyph->bounds.width + padding;
+		const float bottom = glyph->bounds.top + glyph->bounds.height + padding;
+
+		const float u1 = static_cast<float>(glyph->textureRect.left) - padding;
+		const float v1 = static_cast<float>(glyph->textureRect.top) - padding;
+		const float u2 = static_cast<float>(glyph->textureRect.left + glyph->textureRect.width) + padding;
+		const float v2 = static_cast<float>(glyph->textureRect.top + glyph->textureRect.height) + padding;
+
+		const sf::Vector2f origin = m_position + sf::Vector2f{ x - t_outlineThickness, y - t_outlineThickness }; // pen on the baseline
+		const sf::Vertex topLeft{ origin + sf::Vector2f{ left - italicShear * top, top }, t_color, sf::Vector2f{ u1, v1 } };
+		const sf::Vertex topRight{ origin + sf::Vector2f{ right - italicShear * top, top }, t_color, sf::Vector2f{ u2, v1 } };
+		const sf::Vertex bottomLeft{ origin + sf::Vector2f{ left - italicShear * bottom, bottom }, t_color, sf::Vector2f{ u1, v2 } };
+		const sf::Vertex bottomRight{ origin + sf::Vector2f{ right - italicShear * bottom, bottom }, t_color, sf::Vector2f{ u2, v2 } };
+
+		m_vertices.push_back(topLeft);
+		m_vertices.push_back(topRight);
+		m_vertices.push_back(bottomLeft);
+		m_vertices.push_back(bottomLeft);
+		m_vertices.push_back(topRight);
+		m_vertices.push_back(bottomRight);
+
+		x += glyph->advance;
+	}
+
+	if (underlined && x > 0.0f)
+	{
+		addUnderline(t_face, x, y, t_color, t_outlineThickness);
+	}
+}
+
+
+/// underline of one line, rounded to whole pixels like sf::Text's
+/// <param name="t_length">pen position at the end of the line</param>
+/// <param name="t_baseline">baseline of the line</param>
+void AtlasText::addUnderline(const GlyphAtlas::Face & t_face, float t_length, float t_baseline, sf::Color t_color, float t_outlineThickness) const
+{
+	const float top = std::floor(t_baseline + t_face.underlineOffset - t_face.underlineThickness / 2.0f + 0.5f);
+	const float bottom = top + std::floor(t_face.underlineThickness + 0.5f);
+	const sf::Vector2f topLeft = m_position + sf::Vector2f{ -t_outlineThickness, top - t_outlineThickness }; // outline is thicker on every side
+	const sf::Vector2f bottomRight = m_position + sf::Vector2f{ t_length + t_outlineThickness, bottom + t_outlineThickness };
+	const sf::Vector2f white = m_atlas->whitePixel(); // the line is untextured
+
+	m_vertices.emplace_back(topLeft, t_color, white);
+	m_vertices.emplace_back(sf::Vector2f{ bottomRight.x, topLeft.y }, t_color, white);
+	m_vertices.emplace_back(sf::Vector2f{ topLeft.x, bottomRight.y }, t_color, white);
+	m_vertices.emplace_back(sf::Vector2f{ topLeft.x, bottomRight.y }, t_color, white);
+	m_vertices.emplace_back(sf::Vector2f{ bottomRight.x, topLeft.y }, t_color, white);
+	m_vertices.emplace_back(bottomRight, t_color, white);
+}
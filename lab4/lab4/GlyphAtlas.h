@@ -0,0 +1,111 @@
+// Author: Michal K.
+
+#ifndef GLYPH_ATLAS
+#define GLYPH_ATLAS
+
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+// every glyph the game's text needs, baked once at startup into one texture
+// a face is one character size, weight and outline thickness, each asks only for the characters it will show
+// kerning of those characters is looked up once too, laying out text afterwards never touches the font
+class GlyphAtlas
+{
+public:
+	static const char FIRST_CHARACTER = ' '; // printable ASCII only
+	static const char LAST_CHARACTER = '~';
+	static const std::size_t CHARACTER_COUNT = LAST_CHARACTER - FIRST_CHARACTER + 1;
+
+	struct Glyph
+	{
+		bool baked = false; // asked for and rasterised, other characters are left out of the text
+		float advance = 0.0f; // distance to the next character
+		sf::FloatRect bounds; // relative to the baseline, like sf::Glyph
+		sf::IntRect textureRect; // in the atlas texture
+	};
+
+	struct Face
+	{
+		unsigned characterSize = 0u;
+		bool bold = false;
+		float outlineThickness = 0.0f; // glyphs of the outline drawn under the fill, zero for fill glyphs
+		std::string characters; // every character asked for
+
+		// filled in by build()
+		std::array<Glyph, CHARACTER_COUNT> glyphs; // by character - FIRST_CHARACTER
+		std::vector<std::pair<std::uint16_t, float>> kerning; // non zero pairs of characters, sorted by pair
+		float lineSpacing = 0.0f;
+		float underlineOffset = 0.0f; // below the baseline
+		float underlineThickness = 0.0f;
+
+		const Glyph * glyph(char t_character) const; // null if the character was not baked
+		float kerningOf(char t_first, char t_second) const; // offset added before t_second, zero if t_first is not a character
+	};
+
+	// characters a face has to show, call for every text before build(), asking twice for a character is fine
+	void add(unsigned t_characterSize, bool t_bold, float t_outlineThickness, const std::string & t_characters);
+	bool build(const sf::Font & t_font); // rasterises every face into the texture, false if it cannot be created
+
+	const Face * face(unsigned t_characterSize, bool t_bold, float t_outlineThickness) const; // null if never added
+	const sf::Texture & texture() const { return m_texture; }
+	sf::Vector2f whitePixel() const { return sf::Vector2f{ WHITE_SIZE / 2.0f, WHITE_SIZE / 2.0f }; } // texture coordinates of opaque white
+
+private:
+	static const unsigned WIDTH = 512u; // pixels across the atlas, rows of glyphs are stacked down it
+	static const unsigned WHITE_SIZE = 4u; // opaque white square in the top left corner, for underlines and untextured vertices
+	static const unsigned PADDING = 2u; // transparent pixels around every glyph, text samples one past its edge
+
+	std::vector<Face> m_faces; // in the order added
+	sf::Texture m_texture; // every glyph of every face
+};
+
+
+// one line of text drawn from a GlyphAtlas, laid out exactly like sf::Text with the same setters
+// the vertices are only rebuilt when something changed, and rewritten in place as long as the string fits what was reserved
+// vertices are in playfield coordinates, outline first, so a batch can draw them as they are
+class AtlasText
+{
+public:
+	static const std::size_t RESERVED_CHARACTERS = 32u; // vertices for this many characters are reserved up front
+
+	void setAtlas(const GlyphAtlas & t_atlas) { m_atlas = &t_atlas; m_geometryNeedUpdate = true; }
+	void setString(const char * t_string); // allocates only if the string is longer than anything set before
+	void setCharacterSize(unsigned t_size) { m_characterSize = t_size; m_geometryNeedUpdate = true; }
+	void setStyle(sf::Uint32 t_style) { m_style = t_style; m_geometryNeedUpdate = true; } // sf::Text::Style flags, strike through is not drawn
+	void setFillColor(sf::Color t_color) { m_fillColor = t_color; m_geometryNeedUpdate = true; }
+	void setOutlineColor(sf::Color t_color) { m_outlineColor = t_color; m_geometryNeedUpdate = true; }
+	void setOutlineThickness(float t_thickness) { m_outlineThickness = t_thickness; m_geometryNeedUpdate = true; }
+	void setPosition(sf::Vector2f t_position) { m_position = t_position; m_geometryNeedUpdate = true; }
+	void setPosition(float t_x, float t_y) { setPosition(sf::Vector2f{ t_x, t_y }); }
+
+	const GlyphAtlas * getAtlas() const { return m_atlas; }
+	const std::string & getString() const { return m_string; }
+	unsigned getCharacterSize() const { return m_characterSize; }
+	bool isBold() const { return (m_style & sf::Text::Bold) != 0u; }
+	float getOutlineThickness() const { return m_outlineThickness; }
+
+	const std::vector<sf::Vertex> & vertices() const; // triangles of the text, rebuilt here if anything changed
+
+private:
+	void updateGeometry() const;
+	void addGlyphs(const GlyphAtlas::Face & t_face, sf::Color t_color, float t_outlineThickness) const; // every character of one face
+	void addUnderline(const GlyphAtlas::Face & t_face, float t_length, float t_baseline, sf::Color t_color, float t_outlineThickness) const;
+
+	const GlyphAtlas * m_atlas = nullptr; // glyphs come from here
+	std::string m_string;
+	unsigned m_characterSize = 30u; // same defaults as sf::Text
+	sf::Uint32 m_style = sf::Text::Regular;
+	sf::Color m_fillColor = sf::Color::White;
+	sf::Color m_outlineColor = sf::Color::Black;
+	float m_outlineThickness = 0.0f;
+	sf::Vector2f m_position{ 0.0f, 0.0f }; // top left, as sf::Text with no origin
+
+	mutable std::vector<sf::Vertex> m_vertices; // triangles, outline glyphs first
+	mutable bool m_geometryNeedUpdate = true; // something changed since m_vertices was built
+};
+
+#endif // !GLYPH_ATLAS
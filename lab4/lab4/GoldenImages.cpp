@@ -0,0 +1,161 @@
+// Author: Michal K.
+
+#include "GoldenImages.h"
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <SFML/Graphics.hpp>
+#include "Simulation.h"
+#include "AiGunner.h"
+#include "InputRecording.h"
+#include "Snapshot.h"
+#include "Scene.h"
+
+namespace
+{
+	const std::uint64_t GOLDEN_SEED = 2018u; // every golden game is this same game
+	const unsigned PLAY_TICKS = 240u; // ticks played before classic and custom mode are drawn, lasers and explosions in flight
+	const unsigned MAX_TICKS = 36000u; // give up on reaching game over after ten minutes of game time
+	const int CHANNEL_TOLERANCE = 32; // colour channel difference ignored, drivers antialias text and lines differently
+	const float PIXEL_TOLERANCE = 0.005f; // fraction of pixels allowed past CHANNEL_TOLERANCE
+
+	/// state of a fixed seeded game on the screen being checked
+	/// classic and custom mode are played by the AI gunner for PLAY_TICKS, game over is reached by not shooting
+	/// <param name="t_settings">balance the game is played with, the HUD shows its speeds and power</param>
+	Snapshot goldenSnapshot(Simulation::m_gameState t_state, const Settings & t_settings)
+	{
+		const sf::Time timePerTick = sf::seconds(1.0f / 60.0f); // same step as the default tick rate
+		Simulation simulation{ 1u, false, GOLDEN_SEED, t_settings };
+		AiGunner gunner{ t_state == Simulation::customMode ? AiGunner::custom : AiGunner::classic, timePerTick };
+		InputRecorder recorder; // never opened, only the screen is kept
+
+		simulation.update(timePerTick); // main menu resets the game
+
+		if (t_state == Simulation::classicMode || t_state == Simulation::customMode)
+		{
+			simulation.setGameState(t_state);
+			for (unsigned tick = 0u; tick < PLAY_TICKS; tick++)
+			{
+				feedSourceEvents(simulation, gunner, recorder);
+				simulation.update(timePerTick);
+			}
+		}
+		else if (t_state == Simulation::gameOver)
+		{
+			simulation.setGameState(Simulation::classicMode);
+			for (unsigned tick = 0u; tick < MAX_TICKS && simulation.gameState() != Simulation::gameOver; tick++)
+			{
+				simulation.update(timePerTick);
+			}
+		}
+
+		Snapshot snapshot;
+		snapshot.capture(simulation);
+		return snapshot;
+	}
+
+	/// true if at most PIXEL_TOLERANCE of the pixels differ by more than CHANNEL_TOLERANCE in any channel
+	bool matches(const sf::Image & t_actual, const sf::Image & t_golden, float & t_differentFraction)
+	{
+		const sf::Vector2u size = t_actual.getSize(); // both must be this size
+		t_differentFraction = 1.0f;
+
+		if (t_golden.getSize() != size)
+		{
+			return false;
+		}
+
+		const sf::Uint8 * actual = t_actual.getPixelsPtr(); // rgba rows
+		const sf::Uint8 * golden = t_golden.getPixelsPtr(); // rgba rows
+		const std::size_t pixelCount = static_cast<std::size_t>(size.x) * size.y; // pixels compared
+		std::size_t different = 0u; // pixels past the channel tolerance
+
+		for (std::size_t i = 0u; i < pixelCount; i++)
+		{
+			for (std::size_t channel = 0u; channel < 4u; channel++)
+			{
+				if (std::abs(actual[i * 4u + channel] - golden[i * 4u + channel]) > CHANNEL_TOLERANCE)
+				{
+					different++;
+					break;
+				}
+			}
+		}
+
+		t_differentFraction = static_cast<float>(different) / pixelCount;
+		return t_differentFraction <= PIXEL_TOLERANCE;
+	}
+}
+
+
+/// draws every screen to one render texture with the same Scene the window uses
+/// a failed screen is saved next to its golden image as <name>.actual.png so the two can be compared by eye
+/// missing, rather than failed, only when no golden image could be read at all
+GoldenResult runGoldenImages(const Options & t_options, const Settings & t_settings)
+{
+	const Simulation::m_gameState states[] = { Simulation::mainMenu, Simulation::classicMode, Simulation::customMode, Simulation::gameOver };
+	const char * names[] = { "mainMenu", "classicMode", "customMode", "gameOver" }; // file names, same order as states
+
+	sf::RenderTexture target; // offscreen, never shown
+	if (!target.create(800u, 600u))
+	{
+		std::cout << "golden: problem creating render texture" << std::endl;
+		return goldenFailed;
+	}
+
+	bool passed = true; // every screen matched or was written
+	std::size_t missing = 0u; // golden images that could not be read
+	FrameArena arena; // vertices of the frame being drawn
+	ResourceCache resources{ false, Scene::assets() }; // loaded once for every screen
+	resources.waitForPreload(); // logo is on the main menu from its first frame, as it is once the game has started
+
+	for (std::size_t i = 0u; i < 4u; i++)
+	{
+		Scene scene{ resources }; // fresh HUD text for every screen, as if the game had just reached it
+		arena.reset();
+		scene.draw(target, goldenSnapshot(states[i], t_settings), arena);
+		target.display();
+
+		const sf::Image actual = target.getTexture().copyToImage(); // frame as drawn
+		const std::string path = t_options.goldenPath + "/" + names[i] + ".png"; // golden image of this screen
+
+		if (t_options.goldenUpdate)
+		{
+			const bool saved = actual.saveToFile(path);
+			std::cout << "golden: " << (saved ? "wrote " : "problem writing ") << path << std::endl;
+			passed = passed && saved;
+			continue;
+		}
+
+		sf::Image golden;
+		if (!golden.loadFromFile(path))
+		{
+			std::cout << "golden: problem loading " << path << ", run with --golden-update to create it" << std::endl;
+			passed = false;
+			missing++;
+			continue;
+		}
+
+		float differentFraction = 1.0f; // pixels past the channel tolerance
+		if (matches(actual, golden, differentFraction))
+		{
+			std::cout << "golden: " << names[i] << " matches, " << differentFraction * 100.0f << "% of pixels differ" << std::endl;
+		}
+		else
+		{
+			const std::string actualPath = t_options.goldenPath + "/" + names[i] + ".actual.png"; // for comparing by eye
+			actual.saveToFile(actualPath);
+			std::cout << "golden: " << names[i] << " differs, " << differentFraction * 100.0f << "% of pixels differ, frame saved to "
+				<< actualPath << std::endl;
+			passed = false;
+		}
+	}
+
+	if (missing == 4u)
+	{
+		std::cout << "golden: no golden images in " << t_options.goldenPath << ", skipped" << std::endl;
+		return goldenMissing;
+	}
+
+	return passed ? goldenPassed : goldenFailed;
+}
@@ -0,0 +1,21 @@
+// Author: Michal K.
+
+#ifndef GOLDEN_IMAGES
+#define GOLDEN_IMAGES
+
+#include "Options.h"
+#include "Settings.h"
+
+// outcome of a golden image run, no images at all is told apart so a fresh checkout can skip the check
+enum GoldenResult { goldenPassed, goldenFailed, goldenMissing };
+
+const int GOLDEN_SKIPPED_EXIT = 77; // exit code of lab4 --golden when no image exists yet, ctest's SKIP_RETURN_CODE
+
+// draws main menu, classic mode, custom mode and game over offscreen from fixed seeded games
+// and compares each frame with the png of the same name in t_options.goldenPath, or writes the pngs with --golden-update
+// games are played with t_settings, the shipped settings.ini the images were made with unless --config says otherwise
+// no window is opened, so it runs on a box without a gpu through software OpenGL
+// fails if any screen differs from its golden image, or an image could not be written or only some of them could be read
+GoldenResult runGoldenImages(const Options & t_options, const Settings & t_settings);
+
+#endif // !GOLDEN_IMAGES
@@ -0,0 +1,123 @@
+// Author: Michal K.
+
+#include "Headless.h"
+#include <iostream>
+#include <algorithm>
+#include "Simulation.h"
+#include "InputRecording.h"
+#include "AiGunner.h"
+#include "Profiler.h"
+#include "SoakMonitor.h"
+
+
+/// steps the simulation t_options.headlessTicks times as fast as the cpu allows with no window, then prints ticks per second
+/// every tick is the same fixed step the windowed game uses
+/// with --fast-forward ticks before the next scheduled event are jumped in one step, skipped ticks count as run
+/// the AI gunner looks at every tick, fast forward is left off while it plays
+void runHeadless(const Options & t_options, const Settings & t_settings)
+{
+	const sf::Time timePerFrame = sf::seconds(1.0f / t_options.tickRate); // 60 fps by default
+	const unsigned ticks = t_options.headlessTicks; // ticks to run
+	InputReplay replay; // recorded input, replaces the automatic restarts
+	if (!t_options.replayPath.empty() && !replay.open(t_options.replayPath))
+	{
+		std::cout << "problem loading recording " << t_options.replayPath << std::endl;
+		return;
+	}
+
+	AiGunner gunner{ AiGunner::modeFromName(t_options.aiMode), timePerFrame }; // plays when asked to and nothing is replayed
+	InputSource * source = replay.isOpen() ? &replay : nullptr; // input instead of the automatic restarts, if any
+	if (source == nullptr && !t_options.aiMode.empty())
+	{
+		source = &gunner;
+	}
+
+	const std::uint64_t seed = replay.isOpen() ? replay.seed() : t_options.seed; // seed the simulation gets
+	InputRecorder recorder; // the AI gunner's session, to replay it with a window
+	if (!t_options.recordPath.empty() && !recorder.open(t_options.recordPath, seed))
+	{
+		std::cout << "problem creating recording " << t_options.recordPath << std::endl;
+	}
+
+	Simulation simulation{ t_options.waveSize, t_options.stressTest, seed, t_settings };
+	unsigned gamesPlayed = 0u; // games that ended in game over
+	const bool soaking = t_options.soakMinutes > 0.0f; // every tick is timed for the soak reports
+	Profiler profiler; // one frame per tick while soaking
+	SoakMonitor soak{ t_options.soakMinutes, timePerFrame };
+	sf::Clock clock;
+
+	unsigned skippedTicks = 0u; // ticks jumped by fast forward
+
+	for (unsigned tick = 0u; tick < ticks; tick++)
+	{
+		if (t_options.fastForward && source != &gunner) // jump to the tick the next event or recorded input falls in
+		{
+			std::uint32_t skip = simulation.ticksUntilNextEvent(timePerFrame); // ticks nothing can happen in
+			skip = std::min(skip, ticks - tick - 1u);
+			if (replay.isOpen()) // recorded input must arrive on its tick
+			{
+				skip = std::min(skip, replay.nextTick() > simulation.tick() ? replay.nextTick() - simulation.tick() : 0u);
+			}
+
+			simulation.skipTicks(skip, timePerFrame);
+			tick += skip;
+			skippedTicks += skip;
+		}
+
+		if (soaking) // a tick is a frame of the soak report
+		{
+			profiler.beginFrame();
+		}
+
+		if (source != nullptr)
+		{
+			feedSourceEvents(simulation, *source, recorder); // same order as Game::run, input arrives before the tick it was made for
+		}
+		else if (simulation.gameState() == Simulation::gameOver) // no one to press space, go back to main menu
+		{
+			simulation.setGameState(Simulation::mainMenu);
+		}
+
+		const Simulation::m_gameState stateBefore = simulation.gameState(); // only a tick ends a game
+		simulation.update(timePerFrame);
+
+		if (stateBefore != Simulation::gameOver && simulation.gameState() == Simulation::gameOver) // whoever is playing
+		{
+			gamesPlayed++;
+		}
+
+		if (source == nullptr && simulation.gameState() == Simulation::mainMenu) // main menu has reset the game, play again
+		{
+			simulation.setGameState(Simulation::classicMode);
+		}
+
+		if (soaking)
+		{
+			profiler.endFrame(1u); // whole tick, input included
+			soak.sample(simulation.tick(), simulation.gameState(), simulation.score(), simulation.playerLvl(), profiler);
+		}
+	}
+
+	const float seconds = clock.getElapsedTime().asSeconds(); // wall clock time of whole run
+
+	std::cout << "headless: " << ticks << " ticks in " << seconds << " s, "
+		<< (seconds > 0.0f ? ticks / seconds : 0.0f) << " ticks per second, "
+		<< gamesPlayed << " games over, " << static_cast<float>(ticks) / t_options.tickRate << " s of game time, "
+		<< skippedTicks << " ticks fast forwarded" << std::endl;
+
+	if (source == &gunner)
+	{
+		std::cout << "ai gunner: " << gunner.gamesStarted() << " games started, " << gunner.shotsFired() << " shots fired" << std::endl;
+	}
+
+	if (soaking)
+	{
+		soak.finish();
+	}
+
+	// same seed and same input must always end here, diff this line between runs
+	std::cout << "final state: tick " << simulation.tick() << ", state " << simulation.gameState()
+		<< ", score " << simulation.score() << ", level " << simulation.playerLvl()
+		<< ", xp " << simulation.xp() << ", asteroids " << simulation.world().asteroidCount()
+		<< ", lasers " << simulation.world().laserCount() << std::endl;
+}
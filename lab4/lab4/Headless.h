@@ -0,0 +1,15 @@
+// Author: Michal K.
+
+#ifndef HEADLESS
+#define HEADLESS
+
+#include "Options.h"
+#include "Settings.h"
+
+// steps the simulation t_options.headlessTicks times as fast as the cpu allows with no window, then prints ticks per second
+// classic mode is restarted whenever the game is over so every tick is a gameplay tick
+// with a replay file the recorded input drives the simulation instead and the final state is printed for comparison
+// with --ai the AI gunner plays both menus and games instead, --record keeps its session and --soak reports on a long run
+void runHeadless(const Options & t_options, const Settings & t_settings);
+
+#endif // !HEADLESS
@@ -0,0 +1,31 @@
+// Author: Michal K.
+
+#include "HudValue.h"
+#include <cstdio>
+
+
+/// <param name="t_prefix">text before the number, must outlive the HudValue</param>
+/// <param name="t_suffix">text after the number, must outlive the HudValue</param>
+HudValue::HudValue(const char * t_prefix, const char * t_suffix) :
+	m_prefix{ t_prefix },
+	m_suffix{ t_suffix }
+{
+}
+
+
+/// formats prefix, number and suffix into the fixed buffer, no heap allocation
+/// <param name="t_value">number to show</param>
+/// <returns>true if the text changed and has to be given to the sf::Text again</returns>
+bool HudValue::set(int t_value)
+{
+	if (m_formatted && m_value == t_value)
+	{
+		return false;
+	}
+
+	std::snprintf(m_buffer.data(), m_buffer.size(), "%s%d%s", m_prefix, t_value, m_suffix);
+	m_value = t_value;
+	m_formatted = true;
+
+	return true;
+}
@@ -0,0 +1,26 @@
+// Author: Michal K.
+
+#ifndef HUD_VALUE
+#define HUD_VALUE
+
+#include <array>
+
+// number shown on the HUD between a fixed prefix and suffix, e.g. "Score: " 12 "pts"
+// text is formatted into a fixed buffer and only when the number changes, an unchanged number costs nothing
+class HudValue
+{
+public:
+	HudValue(const char * t_prefix, const char * t_suffix);
+
+	bool set(int t_value); // formats the text if the number changed, true if it did
+	const char * text() const { return m_buffer.data(); } // prefix, number and suffix
+
+private:
+	const char * m_prefix; // text before the number
+	const char * m_suffix; // text after the number
+	int m_value = 0; // number in m_buffer
+	bool m_formatted = false; // m_buffer holds m_value
+	std::array<char, 64> m_buffer{}; // formatted text, never reallocated
+};
+
+#endif // !HUD_VALUE
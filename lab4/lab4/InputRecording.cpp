@@ -0,0 +1,197 @@
+// Author: Michal K.
+
+#include "InputRecording.h"
+#include "Simulation.h"
+
+static const char MAGIC[4] = { 'M', 'C', '1', 'R' }; // first bytes of every recording
+static const std::uint32_t VERSION = 1u; // bumped whenever the record layout changes
+
+// record types, stored in one byte
+static const std::uint8_t KEY_PRESSED = 0u;
+static const std::uint8_t MOUSE_PRESSED = 1u;
+
+
+/// writes an unsigned number of t_bytes bytes, lowest byte first so files match across platforms
+static void writeNumber(std::ofstream & t_file, std::uint64_t t_value, int t_bytes)
+{
+	for (int i = 0; i < t_bytes; i++)
+	{
+		t_file.put(static_cast<char>((t_value >> (8 * i)) & 0xFFu));
+	}
+}
+
+
+/// reads an unsigned number of t_bytes bytes written by writeNumber, false at end of file
+static bool readNumber(std::ifstream & t_file, std::uint64_t & t_value, int t_bytes)
+{
+	t_value = 0u;
+
+	for (int i = 0; i < t_bytes; i++)
+	{
+		const int byte = t_file.get();
+		if (byte == std::char_traits<char>::eof())
+		{
+			return false;
+		}
+
+		t_value |= static_cast<std::uint64_t>(byte & 0xFF) << (8 * i);
+	}
+
+	return true;
+}
+
+
+/// starts a new recording file, header stores the seed so a replay can recreate the simulation
+bool InputRecorder::open(const std::string & t_path, std::uint64_t t_seed)
+{
+	m_file.open(t_path, std::ios::binary | std::ios::trunc);
+	if (!m_file.is_open())
+	{
+		return false;
+	}
+
+	m_file.write(MAGIC, sizeof(MAGIC));
+	writeNumber(m_file, VERSION, 4);
+	writeNumber(m_file, t_seed, 8);
+
+	return true;
+}
+
+
+/// records key presses and mouse clicks, everything else never changes the simulation
+/// record is tick (4 bytes), type (1), key or button (1), x (2), y (2)
+/// key codes are signed bytes like x and y are signed shorts, sf::Keyboard::Unknown is -1
+void InputRecorder::record(std::uint32_t t_tick, const sf::Event & t_event)
+{
+	if (!m_file.is_open())
+	{
+		return;
+	}
+
+	if (sf::Event::KeyPressed == t_event.type)
+	{
+		writeNumber(m_file, t_tick, 4);
+		writeNumber(m_file, KEY_PRESSED, 1);
+		writeNumber(m_file, static_cast<std::uint8_t>(static_cast<std::int8_t>(t_event.key.code)), 1);
+		writeNumber(m_file, 0u, 4); // no position
+	}
+
+	if (sf::Event::MouseButtonPressed == t_event.type)
+	{
+		writeNumber(m_file, t_tick, 4);
+		writeNumber(m_file, MOUSE_PRESSED, 1);
+		writeNumber(m_file, static_cast<std::uint8_t>(t_event.mouseButton.button), 1);
+		writeNumber(m_file, static_cast<std::uint16_t>(t_event.mouseButton.x), 2);
+		writeNumber(m_file, static_cast<std::uint16_t>(t_event.mouseButton.y), 2);
+	}
+}
+
+
+/// opens a recording and reads its header, false if file is missing or not a recording
+bool InputReplay::open(const std::string & t_path)
+{
+	m_file.open(t_path, std::ios::binary);
+	if (!m_file.is_open())
+	{
+		return false;
+	}
+
+	char magic[4]; // must match MAGIC
+	std::uint64_t version = 0u; // must match VERSION
+
+	m_file.read(magic, sizeof(magic));
+	if (!m_file || std::char_traits<char>::compare(magic, MAGIC, sizeof(MAGIC)) != 0
+		|| !readNumber(m_file, version, 4) || version != VERSION || !readNumber(m_file, m_seed, 8))
+	{
+		m_file.close();
+		return false;
+	}
+
+	m_hasPending = readRecord();
+	return true;
+}
+
+
+/// next recorded event for a tick up to t_tick, false once every event up to t_tick was returned
+bool InputReplay::nextEvent(std::uint32_t t_tick, sf::Event & t_event)
+{
+	if (!m_hasPending || m_pendingTick > t_tick) // nothing recorded for this tick yet
+	{
+		return false;
+	}
+
+	t_event = m_pendingEvent;
+	m_hasPending = readRecord();
+
+	return true;
+}
+
+
+/// next recorded event for a tick up to the simulation's current tick
+bool InputReplay::nextEvent(const Simulation & t_simulation, sf::Event & t_event)
+{
+	return nextEvent(t_simulation.tick(), t_event);
+}
+
+
+/// reads next record into m_pendingTick and m_pendingEvent, false at end of file
+bool InputReplay::readRecord()
+{
+	std::uint64_t tick, type, code, x, y;
+
+	if (!readNumber(m_file, tick, 4) || !readNumber(m_file, type, 1) || !readNumber(m_file, code, 1)
+		|| !readNumber(m_file, x, 2) || !readNumber(m_file, y, 2))
+	{
+		return false;
+	}
+
+	m_pendingTick = static_cast<std::uint32_t>(tick);
+
+	if (type == KEY_PRESSED)
+	{
+		m_pendingEvent.type = sf::Event::KeyPressed;
+		m_pendingEvent.key.code = static_cast<sf::Keyboard::Key>(static_cast<std::int8_t>(code));
+		m_pendingEvent.key.alt = false;
+		m_pendingEvent.key.control = false;
+		m_pendingEvent.key.shift = false;
+		m_pendingEvent.key.system = false;
+	}
+
+	else
+	{
+		m_pendingEvent.type = sf::Event::MouseButtonPressed;
+		m_pendingEvent.mouseButton.button = static_cast<sf::Mouse::Button>(code);
+		m_pendingEvent.mouseButton.x = static_cast<std::int16_t>(x);
+		m_pendingEvent.mouseButton.y = static_cast<std::int16_t>(y);
+	}
+
+	return true;
+}
+
+
+/// hands a user event to the simulation, recorded against the tick it arrives on
+/// user input is ignored while a replay or the AI gunner drives the simulation
+void feedUserEvent(Simulation & t_simulation, InputRecorder & t_recorder, const InputSource * t_source, const sf::Event & t_event)
+{
+	if (t_source != nullptr)
+	{
+		return;
+	}
+
+	t_recorder.record(t_simulation.tick(), t_event);
+	t_simulation.processEvent(t_event);
+}
+
+
+/// scripted input is handed over on the tick it was made for, and recorded against it like user input
+/// a replay being recorded again gives a copy of itself
+void feedSourceEvents(Simulation & t_simulation, InputSource & t_source, InputRecorder & t_recorder)
+{
+	sf::Event nextEvent; // event from the source
+
+	while (t_source.nextEvent(t_simulation, nextEvent))
+	{
+		t_recorder.record(t_simulation.tick(), nextEvent);
+		t_simulation.processEvent(nextEvent);
+	}
+}
@@ -0,0 +1,60 @@
+// Author: Michal K.
+
+#ifndef INPUT_RECORDING
+#define INPUT_RECORDING
+
+#include <SFML/Window.hpp>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include "InputSource.h"
+
+// binary recording of the key presses and mouse clicks a simulation received, tagged with the tick they arrived on
+// file is an 16 byte header (magic, version, seed) then one 10 byte record per event
+// replaying a file with the seed it stores re-drives the simulation through exactly the same session
+
+// writes events to a recording file as they are handled
+class InputRecorder
+{
+public:
+	bool open(const std::string & t_path, std::uint64_t t_seed); // starts a new file, false if it can't be created
+	void record(std::uint32_t t_tick, const sf::Event & t_event); // only key presses and mouse clicks are kept
+	bool isOpen() const { return m_file.is_open(); } // recording in progress
+
+private:
+	std::ofstream m_file; // recording file
+};
+
+
+// reads events back from a recording file tick by tick
+class InputReplay : public InputSource
+{
+public:
+	bool open(const std::string & t_path); // false if file is missing or not a recording
+	std::uint64_t seed() const { return m_seed; } // seed the recorded simulation was created with
+	bool isOpen() const { return m_file.is_open(); } // replay in progress
+
+	// next recorded event for a tick up to t_tick, false once every event up to t_tick was returned
+	bool nextEvent(std::uint32_t t_tick, sf::Event & t_event);
+	bool nextEvent(const Simulation & t_simulation, sf::Event & t_event) override; // up to the simulation's current tick
+	bool finished() const { return !m_hasPending; } // every recorded event was returned
+	std::uint32_t nextTick() const { return m_hasPending ? m_pendingTick : UINT32_MAX; } // tick of the next event
+
+private:
+	bool readRecord(); // reads next record into m_pendingTick and m_pendingEvent
+
+	std::ifstream m_file; // recording file
+	std::uint64_t m_seed = 0u; // seed stored in header
+	bool m_hasPending = false; // a record has been read but not returned yet
+	std::uint32_t m_pendingTick = 0u; // tick of record read ahead
+	sf::Event m_pendingEvent{}; // event of record read ahead
+};
+
+
+// hands a user event to the simulation and records it, user input is ignored while t_source drives the simulation
+void feedUserEvent(Simulation & t_simulation, InputRecorder & t_recorder, const InputSource * t_source, const sf::Event & t_event);
+
+// hands the simulation every event t_source has for its current tick, recorded so a scripted session can be replayed
+void feedSourceEvents(Simulation & t_simulation, InputSource & t_source, InputRecorder & t_recorder);
+
+#endif // !INPUT_RECORDING
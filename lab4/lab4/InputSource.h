@@ -0,0 +1,23 @@
+// Author: Michal K.
+
+#ifndef INPUT_SOURCE
+#define INPUT_SOURCE
+
+#include <SFML/Window.hpp>
+
+class Simulation;
+
+// anything that plays the game in place of the user, a recording or the AI gunner
+// asked for events before every tick, they are handed to Simulation::processEvent() like window events
+// user input is ignored while a source drives the simulation
+class InputSource
+{
+public:
+	virtual ~InputSource() = default;
+
+	// next event for the simulation's current tick, false once there is nothing more to do this tick
+	// may be asked again within the same tick, an event is only returned once
+	virtual bool nextEvent(const Simulation & t_simulation, sf::Event & t_event) = 0;
+};
+
+#endif // !INPUT_SOURCE
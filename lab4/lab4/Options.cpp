@@ -0,0 +1,217 @@
+// Author: Michal K.
+
+#include "Options.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <iostream>
+
+
+namespace
+{
+	/// first:last:steps of a balance sweep, the default in t_range is kept and said so unless all three are there
+	void readSweepRange(const char * t_name, const char * t_text, SweepRange & t_range)
+	{
+		char * end = nullptr; // just past the number read
+		const float first = std::strtof(t_text, &end);
+		const bool firstRead = end != t_text && *end == ':';
+		const char * lastText = firstRead ? end + 1 : t_text;
+		const float last = std::strtof(lastText, &end);
+		const bool lastRead = firstRead && end != lastText && *end == ':';
+		const char * stepsText = lastRead ? end + 1 : t_text;
+		const long steps = std::strtol(stepsText, &end, 10);
+
+		if (lastRead && end != stepsText && *end == '\0' && steps >= 1)
+		{
+			t_range = SweepRange{ first, last, static_cast<unsigned>(steps) };
+		}
+		else
+		{
+			std::cout << t_name << " must be first:last:steps, using " << t_range.first << ':' << t_range.last << ':' << t_range.steps << std::endl;
+		}
+	}
+}
+
+
+/// reads command line arguments
+/// --benchmark runs the benchmarks instead of the game
+/// --benchmark-out <file> writes every benchmark result as json, compare it with benchmarks/compare_benchmarks.py
+/// --config <file> reads settings from file instead of ASSETS/settings.ini
+/// --wave <count> launches count asteroids per wave for load testing, whatever the settings say
+/// --stress fires lasers every tick and reports heap allocations made by the update loop
+/// --rate <hz> simulation ticks per second, 30, 60, 120 or 240, game plays the same at every rate
+/// --headless <ticks> steps the game with no window as fast as possible and reports ticks per second
+/// --fast-forward lets --headless skip ticks in which nothing but straight line movement happens
+/// --seed <number> seeds the simulation so a run can be repeated
+/// --record <file> records key presses and mouse clicks with the seed
+/// --replay <file> plays a recording back instead of user input, seed comes from the recording
+/// --threaded runs the simulation on its own thread, the window draws interpolated snapshots of it
+/// --slow-render <ms> makes every frame take ms longer, to check the simulation keeps its tick rate
+/// --mmap-assets memory-maps fonts and images instead of reading them, compare the startup report with and without
+/// --profile <file> writes frame timings on exit, json if the name ends in .json else csv
+/// --golden <folder> draws every screen offscreen and checks it against the golden images in folder
+/// --golden-update writes the golden images of --golden instead of checking them
+/// --batch <file> plays a balance sweep with the AI gunner on every core and writes a csv of results
+/// --batch-games <count> games played for every tuning of the balance sweep
+/// --threads <count> threads playing the balance sweep, every core by default
+/// --sweep-speed <first:last:steps> asteroid speed increments the balance sweep tries, 6:24:4 by default
+/// --sweep-decay <first:last:steps> xp gain decays the balance sweep tries, 1.05:1.35:4 by default
+/// --sweep-power <first:last:steps> max powers the balance sweep tries, 150:450:4 by default
+/// --ai <classic|custom|alternate> the AI gunner plays instead of the user, record it with --record to replay the session
+/// --soak <minutes> reports memory, heap allocations and frame times every minutes of play, for long runs with --ai
+Options parseOptions(int argc, char * argv[])
+{
+	Options options;
+	options.seed = static_cast<std::uint64_t>(time(NULL)); // different game every run unless seeded
+
+	for (int i = 1; i < argc; i++)
+	{
+		const bool hasValue = i + 1 < argc; // argument is followed by a value
+
+		if (std::strcmp(argv[i], "--benchmark") == 0)
+		{
+			options.benchmark = true;
+		}
+
+		else if (std::strcmp(argv[i], "--benchmark-out") == 0 && hasValue)
+		{
+			options.benchmarkPath = argv[++i];
+		}
+
+		else if (std::strcmp(argv[i], "--config") == 0 && hasValue)
+		{
+			options.configPath = argv[++i];
+		}
+
+		else if (std::strcmp(argv[i], "--wave") == 0 && hasValue)
+		{
+			options.waveSize = static_cast<unsigned>(std::atoi(argv[++i]));
+		}
+
+		else if (std::strcmp(argv[i], "--stress") == 0)
+		{
+			options.stressTest = true;
+		}
+
+		else if (std::strcmp(argv[i], "--rate") == 0 && hasValue)
+		{
+			const unsigned rate = static_cast<unsigned>(std::atoi(argv[++i])); // ticks per second asked for
+
+			if (rate == 30u || rate == 60u || rate == 120u || rate == 240u)
+			{
+				options.tickRate = rate;
+			}
+			else
+			{
+				std::cout << "tick rate must be 30, 60, 120 or 240, using " << options.tickRate << std::endl;
+			}
+		}
+
+		else if (std::strcmp(argv[i], "--headless") == 0 && hasValue)
+		{
+			options.headlessTicks = static_cast<unsigned>(std::atoi(argv[++i]));
+		}
+
+		else if (std::strcmp(argv[i], "--fast-forward") == 0)
+		{
+			options.fastForward = true;
+		}
+
+		else if (std::strcmp(argv[i], "--seed") == 0 && hasValue)
+		{
+			options.seed = std::strtoull(argv[++i], nullptr, 10);
+		}
+
+		else if (std::strcmp(argv[i], "--record") == 0 && hasValue)
+		{
+			options.recordPath = argv[++i];
+		}
+
+		else if (std::strcmp(argv[i], "--replay") == 0 && hasValue)
+		{
+			options.replayPath = argv[++i];
+		}
+
+		else if (std::strcmp(argv[i], "--threaded") == 0)
+		{
+			options.threaded = true;
+		}
+
+		else if (std::strcmp(argv[i], "--slow-render") == 0 && hasValue)
+		{
+			options.slowRenderMs = static_cast<unsigned>(std::atoi(argv[++i]));
+		}
+
+		else if (std::strcmp(argv[i], "--mmap-assets") == 0)
+		{
+			options.mapAssets = true;
+		}
+
+		else if (std::strcmp(argv[i], "--profile") == 0 && hasValue)
+		{
+			options.profilePath = argv[++i];
+		}
+
+		else if (std::strcmp(argv[i], "--golden") == 0 && hasValue)
+		{
+			options.goldenPath = argv[++i];
+		}
+
+		else if (std::strcmp(argv[i], "--golden-update") == 0)
+		{
+			options.goldenUpdate = true;
+		}
+
+		else if (std::strcmp(argv[i], "--batch") == 0 && hasValue)
+		{
+			options.batchPath = argv[++i];
+		}
+
+		else if (std::strcmp(argv[i], "--batch-games") == 0 && hasValue)
+		{
+			options.batchGames = std::max(1, std::atoi(argv[++i]));
+		}
+
+		else if (std::strcmp(argv[i], "--threads") == 0 && hasValue)
+		{
+			options.batchThreads = static_cast<unsigned>(std::atoi(argv[++i]));
+		}
+
+		else if (std::strcmp(argv[i], "--sweep-speed") == 0 && hasValue)
+		{
+			readSweepRange("--sweep-speed", argv[++i], options.sweepSpeedIncrement);
+		}
+
+		else if (std::strcmp(argv[i], "--sweep-decay") == 0 && hasValue)
+		{
+			readSweepRange("--sweep-decay", argv[++i], options.sweepXpDecay);
+		}
+
+		else if (std::strcmp(argv[i], "--sweep-power") == 0 && hasValue)
+		{
+			readSweepRange("--sweep-power", argv[++i], options.sweepMaxPower);
+		}
+
+		else if (std::strcmp(argv[i], "--ai") == 0 && hasValue)
+		{
+			const std::string mode = argv[++i]; // mode asked for
+
+			if (mode == "classic" || mode == "custom" || mode == "alternate")
+			{
+				options.aiMode = mode;
+			}
+			else
+			{
+				std::cout << "ai mode must be classic, custom or alternate, the user plays" << std::endl;
+			}
+		}
+
+		else if (std::strcmp(argv[i], "--soak") == 0 && hasValue)
+		{
+			options.soakMinutes = std::max(0.0f, static_cast<float>(std::atof(argv[++i])));
+		}
+	}
+
+	return options;
+}
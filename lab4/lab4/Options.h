@@ -0,0 +1,52 @@
+// Author: Michal K.
+
+#ifndef OPTIONS
+#define OPTIONS
+
+#include <cstdint>
+#include <string>
+
+// values of one balance setting tried by the balance sweep, steps values evenly spaced from first to last
+struct SweepRange
+{
+	float first; // first value tried
+	float last; // last value tried
+	unsigned steps; // values tried, one tries only first
+
+	float value(unsigned t_step) const { return steps > 1u ? first + (last - first) * t_step / (steps - 1u) : first; }
+};
+
+// settings picked on the command line, see parseOptions() for every argument
+struct Options
+{
+	bool benchmark = false; // run the benchmarks instead of the game
+	std::string benchmarkPath; // benchmark results are written here as json, empty for none
+	std::string configPath; // settings file, empty for ASSETS/settings.ini
+	unsigned waveSize = 0u; // asteroids per wave in both modes, zero uses the settings file
+	bool stressTest = false; // play on its own and count heap allocations
+	unsigned tickRate = 60u; // simulation ticks per second, 30, 60, 120 or 240
+	unsigned headlessTicks = 0u; // ticks to run without a window, zero opens the window
+	bool fastForward = false; // headless jumps straight to the next scheduled event when nothing else can happen
+	std::uint64_t seed = 0u; // seed of the simulation's random numbers
+	std::string recordPath; // file key presses and mouse clicks are recorded to, empty for none
+	std::string replayPath; // recording to play back instead of user input, empty for none
+	bool threaded = false; // simulation runs on its own thread
+	unsigned slowRenderMs = 0u; // extra milliseconds every frame takes to render
+	bool mapAssets = false; // asset files are memory-mapped instead of read
+	std::string profilePath; // frame timings are written here on exit, .json or csv, empty for none
+	std::string goldenPath; // folder of golden images every screen is checked against, empty plays the game instead
+	bool goldenUpdate = false; // write the golden images instead of checking them
+	std::string batchPath; // balance sweep results are written here, empty plays the game instead
+	unsigned batchGames = 20u; // games played for every tuning of the balance sweep
+	unsigned batchThreads = 0u; // threads playing the balance sweep, zero for one per core
+	SweepRange sweepSpeedIncrement{ 6.0f, 24.0f, 4u }; // asteroid speed gained per hit, pixels per second
+	SweepRange sweepXpDecay{ 1.05f, 1.35f, 4u }; // xp gain divided by this on level up
+	SweepRange sweepMaxPower{ 150.0f, 450.0f, 4u }; // power bar capacity, the AI gunner never waits for more than 430
+	std::string aiMode; // classic, custom or alternate for the AI gunner to play, empty lets the user play
+	float soakMinutes = 0.0f; // minutes of play between soak reports, zero for none
+};
+
+// reads command line arguments, seed is the current time unless --seed is given
+Options parseOptions(int argc, char * argv[]);
+
+#endif // !OPTIONS
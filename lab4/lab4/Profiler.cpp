@@ -0,0 +1,204 @@
+// Author: Michal K.
+
+#include "Profiler.h"
+#include "AllocationCounter.h"
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+
+
+namespace
+{
+	const char * const PHASE_NAMES[Profiler::PHASE_COUNT + 1] = { "events", "update", "render", "frame" };
+}
+
+
+/// scratch buffer for percentiles is allocated once here, never while the game runs
+Profiler::Profiler()
+{
+	m_sorted.reserve(SAMPLE_COUNT);
+}
+
+
+/// starts timing a new frame
+void Profiler::beginFrame()
+{
+	m_current = FrameSample{};
+	m_frameClock.restart();
+	m_frameAllocations = threadAllocationCount();
+}
+
+
+/// stores the frame in the ring buffer, overwriting the oldest one when full
+/// heap allocations are counted up to here, storing the frame itself allocates nothing
+/// <param name="t_updateSteps">updates the catch-up loop ran, every one past the first is a dropped frame</param>
+void Profiler::endFrame(unsigned t_updateSteps)
+{
+	m_current.frameMs = m_frameClock.getElapsedTime().asMicroseconds() / 1000.0f;
+	m_current.updateSteps = static_cast<std::uint8_t>(std::min(t_updateSteps, 255u));
+	m_current.heapAllocations = static_cast<std::uint32_t>(threadAllocationCount() - m_frameAllocations);
+
+	m_samples[m_next] = m_current;
+	m_next = (m_next + 1u) % SAMPLE_COUNT;
+	m_count = m_count < SAMPLE_COUNT ? m_count + 1u : SAMPLE_COUNT;
+
+	m_frames++;
+	m_droppedFrames += t_updateSteps > 1u ? t_updateSteps - 1u : 0u;
+	m_maxUpdateSteps = std::max(m_maxUpdateSteps, t_updateSteps);
+	m_allocatingFrames += m_current.heapAllocations > 0u ? 1u : 0u;
+}
+
+
+/// nearest rank percentile of a phase over the stored frames
+/// <param name="t_phase">Phase, or PHASE_COUNT for whole frames</param>
+/// <param name="t_percentile">0 - 100</param>
+/// <returns>milliseconds, zero if no frames stored</returns>
+float Profiler::percentile(unsigned t_phase, float t_percentile) const
+{
+	if (m_count == 0u)
+	{
+		return 0.0f;
+	}
+
+	m_sorted.clear();
+	for (std::size_t i = 0u; i < m_count; i++)
+	{
+		m_sorted.push_back(t_phase < PHASE_COUNT ? m_samples[i].phaseMs[t_phase] : m_samples[i].frameMs);
+	}
+
+	const std::size_t rank = std::min(m_count - 1u, static_cast<std::size_t>(t_percentile / 100.0f * m_count));
+	std::nth_element(m_sorted.begin(), m_sorted.begin() + rank, m_sorted.end());
+
+	return m_sorted[rank];
+}
+
+
+/// p50/p95/p99 of every phase and the frame counters, one phase per line
+/// building the text allocates, so frames that refresh the overlay count as allocating frames
+std::string Profiler::overlayText() const
+{
+	std::ostringstream text;
+	text << std::fixed << std::setprecision(2) << "ms      p50   p95   p99\n";
+
+	for (unsigned phase = 0u; phase <= PHASE_COUNT; phase++)
+	{
+		text << std::left << std::setw(7) << PHASE_NAMES[phase] << std::right
+			<< std::setw(6) << percentile(phase, 50.0f)
+			<< std::setw(6) << percentile(phase, 95.0f)
+			<< std::setw(6) << percentile(phase, 99.0f) << "\n";
+	}
+
+	text << "dropped " << m_droppedFrames << " of " << m_frames << ", worst catch-up " << m_maxUpdateSteps << "\n";
+	text << "heap allocations " << (m_count > 0u ? m_samples[(m_next + SAMPLE_COUNT - 1u) % SAMPLE_COUNT].heapAllocations : 0u)
+		<< " last frame, " << m_allocatingFrames << " frames allocated";
+
+	return text.str();
+}
+
+
+/// one row per stored frame, oldest first
+/// <returns>false if the file can't be created</returns>
+bool Profiler::writeCsv(const std::string & t_path) const
+{
+	std::ofstream file{ t_path };
+	if (!file.is_open())
+	{
+		return false;
+	}
+
+	file << "frame,events_ms,update_ms,render_ms,frame_ms,update_steps,heap_allocations\n";
+
+	const std::size_t oldest = m_count < SAMPLE_COUNT ? 0u : m_next; // first slot in time order
+	for (std::size_t i = 0u; i < m_count; i++)
+	{
+		const FrameSample & sample = m_samples[(oldest + i) % SAMPLE_COUNT];
+
+		file << m_frames - m_count + i << ','
+			<< sample.phaseMs[events] << ',' << sample.phaseMs[update] << ',' << sample.phaseMs[render] << ','
+			<< sample.frameMs << ',' << static_cast<unsigned>(sample.updateSteps) << ',' << sample.heapAllocations << '\n';
+	}
+
+	return static_cast<bool>(file);
+}
+
+
+/// percentiles and counters, then every stored frame oldest first
+/// <returns>false if the file can't be created</returns>
+bool Profiler::writeJson(const std::string & t_path) const
+{
+	std::ofstream file{ t_path };
+	if (!file.is_open())
+	{
+		return false;
+	}
+
+	file << "{\n  \"frames\": " << m_frames << ",\n  \"dropped_frames\": " << m_droppedFrames
+		<< ",\n  \"max_update_steps\": " << m_maxUpdateSteps << ",\n  \"allocating_frames\": " << m_allocatingFrames
+		<< ",\n  \"percentiles_ms\": {\n";
+
+	for (unsigned phase = 0u; phase <= PHASE_COUNT; phase++)
+	{
+		file << "    \"" << PHASE_NAMES[phase] << "\": { \"p50\": " << percentile(phase, 50.0f)
+			<< ", \"p95\": " << percentile(phase, 95.0f) << ", \"p99\": " << percentile(phase, 99.0f)
+			<< (phase < PHASE_COUNT ? " },\n" : " }\n");
+	}
+
+	file << "  },\n  \"sample_columns\": [\"events_ms\", \"update_ms\", \"render_ms\", \"frame_ms\", \"update_steps\", \"heap_allocations\"],\n"
+		<< "  \"samples\": [\n";
+
+	const std::size_t oldest = m_count < SAMPLE_COUNT ? 0u : m_next; // first slot in time order
+	for (std::size_t i = 0u; i < m_count; i++)
+	{
+		const FrameSample & sample = m_samples[(oldest + i) % SAMPLE_COUNT];
+
+		file << "    [" << sample.phaseMs[events] << ", " << sample.phaseMs[update] << ", " << sample.phaseMs[render]
+			<< ", " << sample.frameMs << ", " << static_cast<unsigned>(sample.updateSteps) << ", " << sample.heapAllocations
+			<< (i + 1u < m_count ? "],\n" : "]\n");
+	}
+
+	file << "  ]\n}\n";
+
+	return static_cast<bool>(file);
+}
+
+
+/// clock starts now, at the top of main()
+StartupTimer::StartupTimer()
+{
+	m_marks.reserve(8u);
+}
+
+
+/// a step of startup finished just now
+/// <param name="t_step">name in the report, must outlive the timer</param>
+void StartupTimer::mark(const char * t_step)
+{
+	m_marks.emplace_back(t_step, m_clock.getElapsedTime());
+}
+
+
+/// first frame is shown, every step is printed with the time it took and the total since main()
+/// <param name="t_details">appended on its own line, such as what the resource cache loaded</param>
+void StartupTimer::finish(const std::string & t_details)
+{
+	if (m_finished)
+	{
+		return;
+	}
+
+	mark("first frame shown");
+	m_finished = true;
+
+	std::cout << "startup: " << std::fixed << std::setprecision(1);
+	sf::Time previous = sf::Time::Zero; // end of the step before
+	for (const std::pair<const char *, sf::Time> & step : m_marks)
+	{
+		std::cout << step.first << " " << (step.second - previous).asMicroseconds() / 1000.0f << " ms, ";
+		previous = step.second;
+	}
+	std::cout << previous.asMicroseconds() / 1000.0f << " ms from main() to first frame" << std::endl;
+	std::cout.unsetf(std::ios::floatfield);
+	std::cout << std::setprecision(6) << "startup: " << t_details << std::endl;
+}
@@ -0,0 +1,100 @@
+// Author: Michal K.
+
+#ifndef PROFILER
+#define PROFILER
+
+#include <SFML/System.hpp>
+#include <array>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+// per frame timings of the game loop kept in a ring buffer of the last SAMPLE_COUNT frames
+// a frame is one pass of Game::run: events, any number of catch-up updates, one render
+// heap allocations of the thread running the frame are counted too, steady state play should make none
+class Profiler
+{
+public:
+	enum Phase : std::uint8_t { events, update, render, PHASE_COUNT };
+
+	static const std::size_t SAMPLE_COUNT = 600u; // ten seconds of frames at 60 fps
+
+	struct FrameSample
+	{
+		std::array<float, PHASE_COUNT> phaseMs{}; // milliseconds spent in each phase
+		float frameMs = 0.0f; // whole frame
+		std::uint8_t updateSteps = 0u; // updates run by the catch-up loop this frame
+		std::uint32_t heapAllocations = 0u; // global operator new calls made by this thread during the frame
+	};
+
+	Profiler();
+
+	void beginFrame(); // starts timing a new frame
+	void endFrame(unsigned t_updateSteps); // stores the frame, updates beyond the first were never shown
+	void addTime(Phase t_phase, sf::Time t_time) { m_current.phaseMs[t_phase] += t_time.asMicroseconds() / 1000.0f; }
+
+	std::size_t size() const { return m_count; } // frames stored, at most SAMPLE_COUNT
+	std::uint64_t frameCount() const { return m_frames; } // frames since start
+	std::uint64_t droppedFrames() const { return m_droppedFrames; } // updates never shown since start
+	unsigned maxUpdateSteps() const { return m_maxUpdateSteps; } // most updates one frame had to catch up
+	std::uint64_t allocatingFrames() const { return m_allocatingFrames; } // frames that made any heap allocation
+
+	// t_percentile (0 - 100) of a phase over the stored frames, PHASE_COUNT gives whole frames
+	float percentile(unsigned t_phase, float t_percentile) const;
+
+	std::string overlayText() const; // p50/p95/p99 of every phase and the frame counters, one phase per line
+
+	bool writeCsv(const std::string & t_path) const; // one row per stored frame
+	bool writeJson(const std::string & t_path) const; // summary and every stored frame
+
+private:
+	std::array<FrameSample, SAMPLE_COUNT> m_samples; // ring buffer of frames
+	std::size_t m_next = 0u; // slot the next frame is written to
+	std::size_t m_count = 0u; // slots in use
+	FrameSample m_current; // frame being timed
+	sf::Clock m_frameClock; // restarted at the start of every frame
+	std::size_t m_frameAllocations = 0u; // thread's allocation count at the start of the frame
+	std::uint64_t m_frames = 0u; // frames since start
+	std::uint64_t m_droppedFrames = 0u; // updates never shown since start
+	unsigned m_maxUpdateSteps = 0u; // worst catch-up
+	std::uint64_t m_allocatingFrames = 0u; // frames since start that made any heap allocation
+	mutable std::vector<float> m_sorted; // scratch for percentile(), reserved once
+};
+
+
+// adds the time between construction and destruction to one phase of the current frame
+class ScopedTimer
+{
+public:
+	ScopedTimer(Profiler & t_profiler, Profiler::Phase t_phase) : m_profiler(t_profiler), m_phase(t_phase) {}
+	~ScopedTimer() { m_profiler.addTime(m_phase, m_clock.getElapsedTime()); }
+
+	ScopedTimer(const ScopedTimer &) = delete;
+	ScopedTimer & operator=(const ScopedTimer &) = delete;
+
+private:
+	Profiler & m_profiler; // profiler being filled in
+	Profiler::Phase m_phase; // phase being timed
+	sf::Clock m_clock; // starts on construction
+};
+
+
+// time from main() to the first frame shown, split into the steps on the way there
+// created first thing in main(), each step is marked as it finishes and the last mark prints the report
+class StartupTimer
+{
+public:
+	StartupTimer();
+
+	void mark(const char * t_step); // t_step finished just now, t_step must be a string literal
+	void finish(const std::string & t_details); // first frame shown, prints every step and t_details once
+	bool finished() const { return m_finished; }
+
+private:
+	sf::Clock m_clock; // started in main()
+	std::vector<std::pair<const char *, sf::Time>> m_marks; // steps in the order they finished, time since main()
+	bool m_finished = false; // report printed
+};
+
+#endif // !PROFILER
@@ -0,0 +1,67 @@
+// Author: Michal K.
+
+#include "Random.h"
+
+
+/// generator seeded with t_seed
+Random::Random(std::uint64_t t_seed)
+{
+	seed(t_seed);
+}
+
+
+/// restart sequence from a seed
+/// splitmix64 spreads the seed over the whole state so similar seeds give unrelated sequences
+void Random::seed(std::uint64_t t_seed)
+{
+	for (int i = 0; i < 4; i += 2)
+	{
+		t_seed += 0x9E3779B97F4A7C15ull;
+		std::uint64_t mixed = t_seed;
+		mixed = (mixed ^ (mixed >> 30)) * 0xBF58476D1CE4E5B9ull;
+		mixed = (mixed ^ (mixed >> 27)) * 0x94D049BB133111EBull;
+		mixed = mixed ^ (mixed >> 31);
+
+		m_state[i] = static_cast<std::uint32_t>(mixed);
+		m_state[i + 1] = static_cast<std::uint32_t>(mixed >> 32);
+	}
+}
+
+
+/// rotates bits of x left by k
+static std::uint32_t rotateLeft(std::uint32_t t_x, int t_k)
+{
+	return (t_x << t_k) | (t_x >> (32 - t_k));
+}
+
+
+/// next 32 random bits, xoshiro128**
+std::uint32_t Random::next()
+{
+	const std::uint32_t result = rotateLeft(m_state[1] * 5u, 7) * 9u;
+	const std::uint32_t shifted = m_state[1] << 9;
+
+	m_state[2] ^= m_state[0];
+	m_state[3] ^= m_state[1];
+	m_state[1] ^= m_state[2];
+	m_state[0] ^= m_state[3];
+	m_state[2] ^= shifted;
+	m_state[3] = rotateLeft(m_state[3], 11);
+
+	return result;
+}
+
+
+/// random number <0 - bound - 1>, bound must be positive
+/// multiply and shift instead of modulo, no division and less bias
+int Random::nextInt(int t_bound)
+{
+	return static_cast<int>((static_cast<std::uint64_t>(next()) * static_cast<std::uint32_t>(t_bound)) >> 32);
+}
+
+
+/// random number <0 - 1), top 24 bits fill a float's mantissa exactly
+float Random::nextFloat()
+{
+	return (next() >> 8) * (1.0f / 16777216.0f);
+}
@@ -0,0 +1,24 @@
+// Author: Michal K.
+
+#ifndef RANDOM
+#define RANDOM
+
+#include <cstdint>
+
+// small fast random number generator owned by each simulation, xoshiro128** seeded through splitmix64
+// same seed always gives the same numbers, unlike the global rand() shared by the whole program
+class Random
+{
+public:
+	explicit Random(std::uint64_t t_seed = 0u);
+
+	void seed(std::uint64_t t_seed); // restart sequence from a seed
+	std::uint32_t next(); // next 32 random bits
+	int nextInt(int t_bound); // random number <0 - bound - 1>, like rand() % bound
+	float nextFloat(); // random number <0 - 1)
+
+private:
+	std::uint32_t m_state[4]; // generator state, never all zero
+};
+
+#endif // !RANDOM
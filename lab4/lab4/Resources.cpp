@@ -0,0 +1,182 @@
+// Author: Michal K.
+
+#include "Resources.h"
+#include <iostream>
+#include <sstream>
+
+
+/// starts preloading, if given any files, so they decode while the rest of the game is set up
+/// <param name="t_mapFiles">memory-map asset files instead of reading them, see AssetFile</param>
+/// <param name="t_preload">files to preload, see preload()</param>
+ResourceCache::ResourceCache(bool t_mapFiles, const std::vector<std::string> & t_preload) :
+	m_mapFiles{ t_mapFiles }
+{
+	if (!t_preload.empty())
+	{
+		preload(t_preload);
+	}
+}
+
+
+/// the preload thread decodes into the entries, it must finish before they go
+ResourceCache::~ResourceCache()
+{
+	waitForPreload();
+}
+
+
+/// starts decoding files on a background thread, files asked for meanwhile wait only for themselves
+/// a preload still running is waited for first
+/// <param name="t_relatives">files inside ASSETS in the order they are needed</param>
+void ResourceCache::preload(const std::vector<std::string> & t_relatives)
+{
+	waitForPreload();
+
+	m_preloader = std::thread{ [this, t_relatives]()
+	{
+		for (const std::string & relative : t_relatives)
+		{
+			acquire(relative);
+		}
+	} };
+}
+
+
+/// returns once every file given to preload() is decoded
+void ResourceCache::waitForPreload()
+{
+	if (m_preloader.joinable())
+	{
+		m_preloader.join();
+	}
+}
+
+
+/// font of the file, loaded on first use
+/// <returns>empty font if the file could not be loaded, text drawn with it is invisible</returns>
+const sf::Font & ResourceCache::font(const std::string & t_relative)
+{
+	return acquire(t_relative).font;
+}
+
+
+/// texture of the image file, uploaded on first use and the decoded pixels released
+/// <returns>empty texture if the file could not be loaded</returns>
+const sf::Texture & ResourceCache::texture(const std::string & t_relative)
+{
+	Entry & entry = acquire(t_relative);
+
+	if (!entry.uploaded)
+	{
+		entry.uploaded = true;
+
+		if (!entry.failed && !entry.texture.loadFromImage(entry.image))
+		{
+			std::cout << "problem creating texture " << t_relative << std::endl;
+		}
+		entry.image = sf::Image{}; // pixels are on the graphics card now
+	}
+
+	return entry.texture;
+}
+
+
+/// true if the file is decoded, so drawing can use it without waiting for the disk
+bool ResourceCache::ready(const std::string & t_relative)
+{
+	std::lock_guard<std::mutex> lock{ m_mutex };
+	const auto found = m_entries.find(t_relative);
+	return found != m_entries.end() && found->second.decoded;
+}
+
+
+/// one line for the startup report
+std::string ResourceCache::report()
+{
+	std::lock_guard<std::mutex> lock{ m_mutex };
+	std::ostringstream text;
+
+	text << m_files << " asset files, " << m_bytes / 1024u << " KiB (" << m_mappedBytes / 1024u << " KiB mapped) decoded in "
+		<< m_decodeTime.asMicroseconds() / 1000.0f << " ms, " << m_hits << " requests served from the cache";
+	return text.str();
+}
+
+
+/// entry of the file, decoded before this returns
+/// the first thread to ask decodes it without holding the lock, any other waits for it
+ResourceCache::Entry & ResourceCache::acquire(const std::string & t_relative)
+{
+	std::unique_lock<std::mutex> lock{ m_mutex };
+	const auto found = m_entries.find(t_relative);
+
+	if (found != m_entries.end()) // loaded, or being loaded by another thread
+	{
+		m_hits++;
+		Entry & entry = found->second;
+		m_decoded.wait(lock, [&entry]() { return entry.decoded; });
+		return entry;
+	}
+
+	Entry & entry = m_entries[t_relative]; // nobody else touches it until decoded is set
+	lock.unlock();
+
+	sf::Clock clock;
+	bool mapped = false; // file was mapped rather than read
+	const std::size_t bytes = decode(t_relative, entry, mapped);
+	const sf::Time decodeTime = clock.getElapsedTime();
+
+	lock.lock();
+	entry.decoded = true;
+	m_files += entry.failed ? 0u : 1u;
+	m_bytes += bytes;
+	m_mappedBytes += mapped ? bytes : 0u;
+	m_decodeTime += decodeTime;
+	lock.unlock();
+
+	m_decoded.notify_all();
+	return entry;
+}
+
+
+/// reads the file and decodes it into a font or an image, no OpenGL is touched so any thread can do it
+/// an image's bytes are released once decoded, a font keeps them as it reads glyphs from them later
+/// <param name="t_mapped">set if the file was mapped rather than read</param>
+/// <returns>bytes in the file, zero if it could not be opened</returns>
+std::size_t ResourceCache::decode(const std::string & t_relative, Entry & t_entry, bool & t_mapped)
+{
+	const std::string path = assetPath(t_relative); // where the file is found
+	const std::size_t dot = t_relative.find_last_of('.');
+	const std::string extension = dot == std::string::npos ? "" : t_relative.substr(dot); // picks font or image
+	const bool isFont = extension == ".ttf" || extension == ".otf";
+
+	if (!t_entry.file.open(path, m_mapFiles))
+	{
+		std::cout << "problem loading " << path << std::endl;
+		t_entry.failed = true;
+		return 0u;
+	}
+
+	if (isFont)
+	{
+		t_entry.failed = !t_entry.font.loadFromMemory(t_entry.file.data(), t_entry.file.size());
+	}
+	else
+	{
+		t_entry.failed = !t_entry.image.loadFromMemory(t_entry.file.data(), t_entry.file.size());
+	}
+
+	if (t_entry.failed)
+	{
+		std::cout << "problem decoding " << path << std::endl;
+	}
+
+	const std::size_t bytes = t_entry.file.size();
+	t_mapped = t_entry.file.mapped();
+
+	if (!isFont) // pixels are decoded, the file is no longer needed
+	{
+		t_entry.file.close();
+	}
+
+	return bytes;
+}
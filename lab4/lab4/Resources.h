@@ -0,0 +1,67 @@
+// Author: Michal K.
+
+#ifndef RESOURCES
+#define RESOURCES
+
+#include <SFML/Graphics.hpp>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Assets.h"
+
+// fonts and textures of the ASSETS folder, each file is loaded once however many times it is asked for
+// preload() reads and decodes files on a background thread while the window opens and the main menu is drawn
+// font() and texture() wait for a file still being preloaded, or load it themselves if nobody has yet
+// textures are uploaded to the graphics card by texture(), so it must be called from the thread that draws
+class ResourceCache
+{
+public:
+	// t_mapFiles memory-maps asset files instead of reading them, t_preload is handed to preload() at once
+	explicit ResourceCache(bool t_mapFiles = false, const std::vector<std::string> & t_preload = {});
+	~ResourceCache(); // waits for the preload to finish
+
+	ResourceCache(const ResourceCache &) = delete;
+	ResourceCache & operator=(const ResourceCache &) = delete;
+
+	// files are decoded in order on a background thread, fonts by their .ttf or .otf extension, every other file as an image
+	void preload(const std::vector<std::string> & t_relatives);
+	void waitForPreload(); // returns once every preloaded file is decoded
+
+	const sf::Font & font(const std::string & t_relative); // t_relative as for assetPath(), an empty font if it failed to load
+	const sf::Texture & texture(const std::string & t_relative); // same, only from the thread that draws
+	bool ready(const std::string & t_relative); // decoded, font() and texture() return without touching the disk
+
+	std::string report(); // files loaded, bytes, time spent and requests served from the cache
+
+private:
+	struct Entry
+	{
+		bool decoded = false; // file read and decoded, set under m_mutex
+		bool failed = false; // file missing or not a font or image
+		bool uploaded = false; // texture created from image, only touched by the drawing thread
+		AssetFile file; // a font reads its glyphs from these bytes for as long as it lives, images release them once decoded
+		sf::Font font; // if the file is a font
+		sf::Image image; // pixels of an image until texture() uploads them
+		sf::Texture texture; // if the file is an image and texture() was called
+	};
+
+	Entry & acquire(const std::string & t_relative); // entry of the file, decoded by this thread if nobody else is
+	std::size_t decode(const std::string & t_relative, Entry & t_entry, bool & t_mapped); // reads and decodes the file, no lock held
+
+	const bool m_mapFiles; // memory-map files instead of reading them
+	std::map<std::string, Entry> m_entries; // by relative path, never erased so references stay valid
+	std::mutex m_mutex; // guards m_entries, the decoded flags and the counters
+	std::condition_variable m_decoded; // notified whenever an entry is decoded
+	std::thread m_preloader; // runs preload(), joined by the next preload() or waitForPreload()
+
+	unsigned m_files = 0u; // files decoded successfully
+	std::size_t m_bytes = 0u; // bytes of every file decoded
+	std::size_t m_mappedBytes = 0u; // of m_bytes, bytes mapped rather than read
+	sf::Time m_decodeTime; // time spent reading and decoding, by any thread
+	unsigned m_hits = 0u; // requests for a file that was already loaded or being loaded
+};
+
+#endif // !RESOURCES
@@ -0,0 +1,388 @@
+// Author: Michal K.
+
+#include "Scene.h"
+#include <iostream>
+#include "AllocationCounter.h"
+
+namespace
+{
+	const std::string FONT_FILE{ "FONTS/ariblk.ttf" }; // every text of the game
+	const std::string LOGO_FILE{ "IMAGES/SFML-LOGO.png" }; // 256 by 256, shown a quarter size on the main menu
+}
+
+
+/// lays out every shape and text once, the font is waited for if it is still being preloaded
+/// <param name="t_resources">cache the font and logo come from, must outlive the scene</param>
+/// <param name="t_stressTest">report heap allocations made by HUD updates every 600 frames of play</param>
+Scene::Scene(ResourceCache & t_resources, bool t_stressTest) :
+	m_resources{ t_resources },
+	m_ArialBlackfont{ t_resources.font(FONT_FILE) },
+	m_stressTest{ t_stressTest }
+{
+	setupGameOverText(); // set up game over title text in game over screen
+	setupTitleText(); // set up game title text in main menu
+	
+	setupScene(); // gives rectangle shapes properties based on setupSceneProperties function
+	setupText(); // gives text variables properties based on setupTextProperties function
+	bakeAtlas(); // glyphs of every text are rasterised once, from here on text only rewrites vertices
+
+	// ground and base never move, they go to the graphics card once
+	m_batch.addStaticRect(m_ground);
+	m_batch.addStaticRect(m_base);
+	m_batch.uploadStatic();
+}
+
+
+/// every file the scene draws with, the font first as the scene cannot be built without it
+std::vector<std::string> Scene::assets()
+{
+	return { FONT_FILE, LOGO_FILE };
+}
+
+
+/// clears the target and draws the screen of the snapshot, the caller displays it
+/// <param name="t_target">window or offscreen texture, 800 by 600</param>
+/// <param name="t_snapshot">state to draw</param>
+/// <param name="t_arena">frame's arena, must not be reset before the frame is drawn</param>
+void Scene::draw(sf::RenderTarget & t_target, const Snapshot & t_snapshot, FrameArena & t_arena)
+{
+	const Simulation::m_gameState gameState = t_snapshot.gameState; // screen being drawn
+
+	refreshHud(t_snapshot); // bars and text follow the snapshot
+	updateBatch(t_snapshot, t_arena); // every shape of the frame is collected for drawing
+	addText(gameState); // text goes on top of the shapes
+	t_target.clear();
+	t_target.draw(m_batch); // all shapes and text of this screen
+
+	if (gameState == Simulation::mainMenu) // only draw in main menu
+	{
+		if (!m_logoShown && m_resources.ready(LOGO_FILE)) // preload finished while the menu was up
+		{
+			setupLogo();
+		}
+
+		if (m_logoShown)
+		{
+			t_target.draw(m_logoSprite);
+		}
+	}
+}
+
+
+/// HUD follows the snapshot being drawn, in stress test heap allocations of frames that changed no text are counted
+void Scene::refreshHud(const Snapshot & t_snapshot)
+{
+	// if classic mode or custom mode is currently played
+	if (t_snapshot.gameState == Simulation::classicMode || t_snapshot.gameState == Simulation::customMode)
+	{
+		const std::size_t allocationsBefore = threadAllocationCount(); // to check an unchanged HUD does not allocate, the simulation thread may allocate meanwhile
+		const bool rebuilt = updateHud(t_snapshot);
+
+		if (m_stressTest)
+		{
+			m_hudFrames++;
+			m_hudRebuilds += rebuilt ? 1u : 0u;
+			m_hudAllocations += rebuilt ? 0u : threadAllocationCount() - allocationsBefore;
+		}
+	}
+
+	if (m_stressTest && m_hudFrames >= 600u) // every 600 frames of play
+	{
+		std::cout << "stress test: HUD text rebuilt on " << m_hudRebuilds << " of " << m_hudFrames << " frames, "
+			<< m_hudAllocations << " heap allocations on the other frames" << std::endl;
+
+		m_hudFrames = 0u;
+		m_hudRebuilds = 0u;
+		m_hudAllocations = 0u;
+	}
+}
+
+
+/// HUD bars and text follow the snapshot being drawn
+/// text geometry is only rebuilt when score or level changed, bars are resized every frame
+/// <returns>true if any text was rebuilt</returns>
+bool Scene::updateHud(const Snapshot & t_snapshot)
+{
+	const int score = t_snapshot.score; // current player score
+	const int playerLvl = t_snapshot.playerLvl; // current player level
+	bool rebuilt = false; // any text changed
+
+	m_powerBar.setSize(sf::Vector2f{ t_snapshot.currentPower, 30.0f }); // set size of power bar to updated width
+	m_expBar.setSize(sf::Vector2f{ t_snapshot.xp, 20.0f }); // update size of xp bar
+
+	if (m_scoreValue.set(score)) // update string of score text
+	{
+		m_scoreText.setString(m_scoreValue.text());
+		rebuilt = true;
+	}
+
+	if (m_totalScoreValue.set(score)) // update string of final score text
+	{
+		m_totalScoreText.setString(m_totalScoreValue.text());
+		rebuilt = true;
+	}
+
+	if (m_playerLvlValue.set(playerLvl)) // update string of player level text
+	{
+		m_playerLvlText.setString(m_playerLvlValue.text());
+		rebuilt = true;
+	}
+
+	if (m_scoreMultiplierValue.set(playerLvl)) // update string of score multiplier text
+	{
+		m_scoreMultiplier.setString(m_scoreMultiplierValue.text());
+		rebuilt = true;
+	}
+
+	return rebuilt;
+}
+
+
+/// every shape of the frame is collected for drawing, in the order it is drawn
+/// every projectile is a single line from start point to tip, never grows during flight
+void Scene::updateBatch(const Snapshot & t_snapshot, FrameArena & t_arena)
+{
+	const Simulation::m_gameState gameState = t_snapshot.gameState; // screen being drawn
+	const bool playing = gameState == Simulation::classicMode || gameState == Simulation::customMode;
+
+	m_batch.clear(playing, t_arena); // ground and base only while playing
+
+	if (gameState == Simulation::mainMenu)
+	{
+		m_batch.addRect(m_classicModeButton);
+		m_batch.addRect(m_customModeButton);
+	}
+
+	if (!playing)
+	{
+		return;
+	}
+
+	m_batch.addRect(m_powerBarBackground);
+	m_batch.addRect(m_powerBar);
+
+	if (gameState == Simulation::customMode) // only draw when in custom mode
+	{
+		m_batch.addRect(m_expBarBackground);
+		m_batch.addRect(m_expBar);
+	}
+
+	for (const Sprite & sprite : t_snapshot.sprites) // every asteroid, laser and explosion alive
+	{
+		if (sprite.shape == Renderable::trail) // laser or asteroid path
+		{
+			m_batch.addLine(sprite.startPoint, sprite.tipPoint);
+		}
+		else // explosion ring around laser end point
+		{
+			m_batch.addRing(sprite.tipPoint, sprite.radius, 2.0f, sf::Color(191u, 73u, 0u));
+		}
+	}
+}
+
+
+/// text of the screen is added to the batch after every shape, later text on top
+/// HUD text changed by updateHud() is laid out again here, only its vertices are rewritten
+void Scene::addText(const Simulation::m_gameState t_gameState)
+{
+	if (t_gameState == Simulation::mainMenu) // only draw in main menu
+	{
+		m_batch.addText(m_classicModeText);
+		m_batch.addText(m_customModeText);
+		m_batch.addText(m_titleText);
+	}
+
+	// draw all basic components of game regardless of game mode
+	if (t_gameState == Simulation::classicMode || t_gameState == Simulation::customMode)
+	{
+		m_batch.addText(m_scoreText);
+
+		if (t_gameState == Simulation::customMode) // only draw when in custom mode
+		{
+			m_batch.addText(m_scoreMultiplier);
+			m_batch.addText(m_playerLvlText);
+		}
+	}
+
+	if (t_gameState == Simulation::gameOver) // only draw when game is over
+	{
+		m_batch.addText(m_gameOverText);
+		m_batch.addText(m_totalScoreText);
+		m_batch.addText(m_returnToMenuText);
+	}
+}
+
+
+/// faces of every text with the characters of its string, HUD texts also with every character a number can add
+/// the atlas is built once all faces are known, the batch then draws every text from it
+void Scene::bakeAtlas()
+{
+	AtlasText * const fixedTexts[] = { &m_gameOverText, &m_titleText, &m_classicModeText, &m_customModeText, &m_returnToMenuText };
+	AtlasText * const hudTexts[] = { &m_scoreText, &m_totalScoreText, &m_scoreMultiplier, &m_playerLvlText };
+
+	for (AtlasText * text : fixedTexts)
+	{
+		bakeText(*text, "");
+	}
+
+	for (AtlasText * text : hudTexts)
+	{
+		bakeText(*text, "-0123456789"); // any score or level
+	}
+
+	if (!m_atlas.build(m_ArialBlackfont))
+	{
+		std::cout << "problem creating glyph atlas" << std::endl;
+	}
+
+	m_batch.setAtlas(m_atlas);
+}
+
+
+/// faces of one text, its outline face too if it has one
+/// <param name="t_extra">characters the text may show later on top of its current string</param>
+void Scene::bakeText(const AtlasText & t_text, const std::string & t_extra)
+{
+	const std::string characters = t_text.getString() + t_extra; // every character the text can show
+
+	m_atlas.add(t_text.getCharacterSize(), t_text.isBold(), 0.0f, characters);
+
+	if (t_text.getOutlineThickness() != 0.0f)
+	{
+		m_atlas.add(t_text.getCharacterSize(), t_text.isBold(), t_text.getOutlineThickness(), characters);
+	}
+}
+
+
+/// set up game over title text in game over screen
+void Scene::setupGameOverText()
+{
+	// set text attributes to game over title text
+	m_gameOverText.setAtlas(m_atlas);
+	m_gameOverText.setString("GAME OVER!");
+	m_gameOverText.setStyle(sf::Text::Underlined | sf::Text::Italic | sf::Text::Bold);
+	m_gameOverText.setPosition(100.0f, 250.0f);
+	m_gameOverText.setCharacterSize(80);
+	m_gameOverText.setOutlineColor(sf::Color::Red);
+	m_gameOverText.setFillColor(sf::Color::Black);
+	m_gameOverText.setOutlineThickness(3.0f);
+}
+
+
+/// set up game over title text in game over screen
+void Scene::setupTitleText()
+{
+	// set text attributes to game title text in main menu
+	m_titleText.setAtlas(m_atlas);
+	m_titleText.setString("MISSILE COMMAND: ONE");
+	m_titleText.setStyle(sf::Text::Underlined | sf::Text::Bold);
+	m_titleText.setPosition(120.0f, 100.0f);
+	m_titleText.setCharacterSize(40);
+	m_titleText.setOutlineColor(sf::Color::Yellow);
+	m_titleText.setFillColor(sf::Color::Black);
+	m_titleText.setOutlineThickness(3.0f);
+}
+
+
+/// logo sprite gets its texture, uploaded to the graphics card by this call
+/// top right corner of the main menu, clear of the title and buttons
+void Scene::setupLogo()
+{
+	m_logoSprite.setTexture(m_resources.texture(LOGO_FILE), true);
+	m_logoSprite.setScale(0.25f, 0.25f);
+	m_logoSprite.setPosition(Simulation::WIDTH - 80.0f, 16.0f);
+	m_logoShown = true;
+}
+
+
+/// sets up general text for use in HUD elements
+void Scene::setupTextProperties(AtlasText & t_text, sf::Vector2f t_position, std::string t_string, int t_characterSize)
+{
+	t_text.setAtlas(m_atlas); // set font of text
+	t_text.setString(t_string.c_str()); // set string of text
+	t_text.setFillColor(sf::Color::White); // set color of text
+	t_text.setPosition(t_position); // set position of text
+	t_text.setCharacterSize(static_cast<unsigned>(t_characterSize)); // set character size of text
+}
+
+
+/// gives text variables properties based on setupTextProperties function
+void Scene::setupText()
+{
+	const Snapshot start; // score and level before the first game
+	m_scoreValue.set(start.score);
+	m_totalScoreValue.set(start.score);
+	m_playerLvlValue.set(start.playerLvl);
+	m_scoreMultiplierValue.set(start.playerLvl);
+
+	// set up score text
+	setupTextProperties(m_scoreText, sf::Vector2f{ 10.0f, 555.0f }, m_scoreValue.text(), 18);
+	
+	// set up score multiplier text
+	setupTextProperties(m_scoreMultiplier, sf::Vector2f{ 10.0f, 575.0f }, m_scoreMultiplierValue.text(), 18);
+	
+	// set up player level text
+	setupTextProperties(m_playerLvlText, sf::Vector2f{ 648.0f, 518.0f }, m_playerLvlValue.text(), 14);
+	m_playerLvlText.setFillColor(sf::Color(232, 202, 9)); // custom yellow color
+
+	// set up classic mode text
+	setupTextProperties(m_classicModeText, sf::Vector2f{ 280.0f, 230.0f }, "<1> CLASSIC MODE", 24);
+	m_classicModeText.setFillColor(sf::Color::Black);
+	m_classicModeText.setStyle(sf::Text::Bold);
+
+	// set up custom mode text
+	setupTextProperties(m_customModeText, sf::Vector2f{ 280.0f, 380.0f }, "<2> CUSTOM MODE", 24);
+	m_customModeText.setFillColor(sf::Color::Black);
+	m_customModeText.setStyle(sf::Text::Bold);
+
+	// set up return to menu mode text
+	setupTextProperties(m_returnToMenuText, sf::Vector2f{ 100.0f, 500.0f }, "PRESS <SPACE> TO RETURN TO MAIN MENU", 24);
+	setupTextProperties(m_totalScoreText, sf::Vector2f{ 100.0f, 350.0f }, m_totalScoreValue.text(), 18);
+	m_totalScoreText.setFillColor(sf::Color::Yellow);
+}
+
+
+/// sets up a rectangle shape's position and size
+void Scene::setupSceneProperties(sf::RectangleShape & t_rectangle, sf::Vector2f t_position, sf::Vector2f t_size)
+{
+	t_rectangle.setPosition(t_position); // position of rectangle shape
+	t_rectangle.setSize(t_size); // size of rectangle shape
+}
+
+
+/// gives rectangle shapes properties based on setupSceneProperties function
+void Scene::setupScene()
+{
+	// set up ground rectangle
+	setupSceneProperties(m_ground, sf::Vector2f{ 0.0f, Simulation::GROUND_TOP }, sf::Vector2f{ Simulation::WIDTH, Simulation::HEIGHT - Simulation::GROUND_TOP });
+	m_ground.setFillColor(sf::Color(2, 99, 20)); // dark green color
+	
+	// set up ground rectangle
+	setupSceneProperties(m_base, sf::Vector2f{ Simulation::BASE_CENTRE - 40.0f, Simulation::GROUND_TOP - 60.0f }, sf::Vector2f{ 80.0f, 60.0f });
+	m_base.setFillColor(sf::Color(219, 199, 52)); // golden color
+	
+	// set up power bar rectangle
+	setupSceneProperties(m_powerBar, sf::Vector2f{ 10.0f, 520.0f }, sf::Vector2f{ 0.0f, 30.0f });
+	m_powerBar.setFillColor(sf::Color(188, 5, 5)); // red color
+	
+	// set up power bar background rectangle
+	setupSceneProperties(m_powerBarBackground, sf::Vector2f{ 8.0f, 518.0f }, sf::Vector2f{ 454.0f, 34.0f });
+	m_powerBarBackground.setFillColor(sf::Color::Black);
+
+	// set up xp bar rectangle
+	setupSceneProperties(m_expBar, sf::Vector2f{ 650.0f, 540.0f }, sf::Vector2f{ 0.0f, 20.0f });
+	m_expBar.setFillColor(sf::Color(232, 202, 9));
+	
+	// set up xp bar background rectangle
+	setupSceneProperties(m_expBarBackground, sf::Vector2f{ 648.0f, 538.0f }, sf::Vector2f{ 104.0f, 24.0f });
+	m_expBarBackground.setFillColor(sf::Color::Black);
+
+	// set up classic mode rectangle
+	setupSceneProperties(m_classicModeButton, sf::Vector2f{ 270.0f, 200.0f }, sf::Vector2f{ 300.0f, 100.0f });
+	m_classicModeButton.setFillColor(sf::Color(255, 199, 15)); // custom yellow color
+	
+	// set up custom mode rectangle
+	setupSceneProperties(m_customModeButton, sf::Vector2f{ 270.0f, 350.0f }, sf::Vector2f{ 300.0f, 100.0f });
+	m_customModeButton.setFillColor(sf::Color(216, 41, 10)); // custom red color
+}
+
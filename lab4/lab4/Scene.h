@@ -0,0 +1,94 @@
+// Author: Michal K.
+
+#ifndef SCENE
+#define SCENE
+
+#include <SFML/Graphics.hpp>
+#include "HudValue.h"
+#include "BatchRenderer.h"
+#include "Snapshot.h"
+#include "Resources.h"
+#include "GlyphAtlas.h"
+
+// every shape and text of the game's screens, drawn from a Snapshot to any sf::RenderTarget
+// text is laid out from a glyph atlas baked once in the constructor and drawn in the same batch as the shapes
+// the window, an offscreen sf::RenderTexture for benchmarks and the golden images all draw the same scene
+// draw() never calls display(), the owner of the target decides when the frame is shown
+class Scene
+{
+public:
+	// font is taken from t_resources at once, the logo appears on the main menu once its preload finishes
+	Scene(ResourceCache & t_resources, bool t_stressTest = false); // stress test counts heap allocations made by the HUD
+
+	static std::vector<std::string> assets(); // every file the scene draws with, for ResourceCache::preload()
+
+	// clears the target and draws the screen of t_snapshot, vertices of the frame go into t_arena
+	void draw(sf::RenderTarget & t_target, const Snapshot & t_snapshot, FrameArena & t_arena);
+	const sf::Font & font() const { return m_ArialBlackfont; } // for text drawn on top of the scene
+
+private:
+
+	// functions
+	void refreshHud(const Snapshot & t_snapshot); // HUD follows the snapshot being drawn, allocations counted in stress test
+	bool updateHud(const Snapshot & t_snapshot); // HUD bars and text follow the snapshot being drawn, true if any text was rebuilt
+	void updateBatch(const Snapshot & t_snapshot, FrameArena & t_arena); // every shape of the frame is collected for drawing
+	void addText(Simulation::m_gameState t_gameState); // text of the screen goes on top of the shapes in the batch
+	void bakeAtlas(); // every face and character the texts can show is rasterised into m_atlas
+	void bakeText(const AtlasText & t_text, const std::string & t_extra); // faces of the text are added to m_atlas
+
+	void setupGameOverText(); // set up game over title text in game over screen
+	void setupTitleText(); // set up game over title text in game over screen
+	void setupLogo(); // logo sprite gets its texture, once the cache has it decoded
+	
+	// sets up general text for use in HUD elements
+	void setupTextProperties(AtlasText & t_text, sf::Vector2f t_position, std::string t_string, int t_characterSize);
+	
+	void setupText(); // gives text variables properties based on setupTextProperties function
+	
+	// sets up a rectangle shape's position and size
+	void setupSceneProperties(sf::RectangleShape & t_rectangle, sf::Vector2f t_position, sf::Vector2f t_size);
+	
+	void setupScene(); // gives rectangle shapes properties based on setupSceneProperties function
+
+
+	// variables
+	ResourceCache & m_resources; // fonts and textures, loaded once for every scene
+	const sf::Font & m_ArialBlackfont; // font used by message, owned by m_resources
+	GlyphAtlas m_atlas; // every glyph of the texts below, rasterised from m_ArialBlackfont once
+
+	AtlasText m_gameOverText; // game over text when game is over
+	AtlasText m_titleText; // game title text in main menu
+	AtlasText m_scoreText; // score Text
+	AtlasText m_totalScoreText; // final score  text display when game is over
+	AtlasText m_scoreMultiplier; // multiplier of score gained
+	AtlasText m_playerLvlText; // player current level text
+	AtlasText m_classicModeText; // classic mode text on button
+	AtlasText m_customModeText; // custom mode text on button
+	AtlasText m_returnToMenuText; // return to main menu prompt text
+
+	// numbers in the HUD texts, the texts are only rebuilt when these change
+	HudValue m_scoreValue{ "Score: ", "pts" };
+	HudValue m_totalScoreValue{ "TOTAL SCORE: ", "pts" };
+	HudValue m_playerLvlValue{ "Level: ", "" };
+	HudValue m_scoreMultiplierValue{ "Multiplier: x", "" };
+	bool m_stressTest{ false }; // count heap allocations made by the HUD
+	unsigned m_hudFrames = 0u; // HUD updates since last report
+	unsigned m_hudRebuilds = 0u; // HUD updates that rebuilt text since last report
+	std::size_t m_hudAllocations = 0u; // heap allocations by HUD updates that rebuilt nothing since last report
+
+	sf::Sprite m_logoSprite; // sprite used for sfml logo, its texture is owned by m_resources
+	bool m_logoShown{ false }; // logo texture is set, drawn on the main menu from then on
+
+	sf::RectangleShape m_ground; // ground shape
+	sf::RectangleShape m_base; // base shape
+	sf::RectangleShape m_powerBar; // power bar shape
+	sf::RectangleShape m_powerBarBackground; // background of power bar, no functionality 
+	sf::RectangleShape m_expBar; // player's xp bar shape
+	sf::RectangleShape m_expBarBackground; // background of xp bar, no functionality 
+	sf::RectangleShape m_classicModeButton; // button shape representing classic mode in main menu
+	sf::RectangleShape m_customModeButton; // button shape representing custom mode in main menu
+
+	BatchRenderer m_batch; // every shape and text above plus trails and explosions, drawn in a few draw calls
+};
+
+#endif // !SCENE
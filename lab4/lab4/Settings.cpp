@@ -0,0 +1,164 @@
+// Author: Michal K.
+
+#include "Settings.h"
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+namespace
+{
+	// ini key of a float field of Tuning
+	struct TuningKey
+	{
+		const char * name; // key in the ini file
+		float Tuning::* field; // field it sets
+	};
+
+	const TuningKey TUNING_KEYS[] =
+	{
+		{ "asteroid_speed", &Tuning::asteroidSpeed },
+		{ "asteroid_speed_increment", &Tuning::asteroidSpeedIncrement },
+		{ "laser_speed", &Tuning::laserSpeed },
+		{ "laser_speed_increment", &Tuning::laserSpeedIncrement },
+		{ "max_laser_speed", &Tuning::maxLaserSpeed },
+		{ "power_fill", &Tuning::powerFill },
+		{ "power_fill_increment", &Tuning::powerFillIncrement },
+		{ "max_power_fill", &Tuning::maxPowerFill },
+		{ "max_power", &Tuning::maxPower },
+		{ "xp_gain", &Tuning::xpGain },
+		{ "xp_gain_decay", &Tuning::xpGainDecay },
+		{ "max_xp", &Tuning::maxXp },
+	};
+
+	const float MAX_COUNT = 65536.0f; // window sides and wave sizes past this are typos, and would not fit an unsigned as floats
+
+	/// t_text without leading and trailing spaces and tabs
+	std::string trim(const std::string & t_text)
+	{
+		const std::size_t first = t_text.find_first_not_of(" \t\r"); // npos for a blank line
+		if (first == std::string::npos)
+		{
+			return std::string{};
+		}
+
+		return t_text.substr(first, t_text.find_last_not_of(" \t\r") - first + 1u);
+	}
+
+	/// whole of t_text as a number, false if anything but a number is there
+	bool parseNumber(const std::string & t_text, float & t_number)
+	{
+		char * end = nullptr; // first character not part of the number
+		t_number = std::strtof(t_text.c_str(), &end);
+		return !t_text.empty() && *end == '\0';
+	}
+
+	/// t_value as a count of pixels or asteroids, false unless it is a whole number from 1 to MAX_COUNT
+	bool parseCount(float t_value, unsigned & t_count)
+	{
+		if (t_value < 1.0f || t_value > MAX_COUNT || t_value != std::floor(t_value))
+		{
+			return false;
+		}
+
+		t_count = static_cast<unsigned>(t_value);
+		return true;
+	}
+
+	/// sets one key of a section, false if the key does not exist in it or the value is not a positive number
+	/// nan and inf are numbers to strtof, they are refused here so no system ever reads one
+	bool setKey(Settings & t_settings, const std::string & t_section, const std::string & t_key, float t_value)
+	{
+		if (!std::isfinite(t_value) || t_value <= 0.0f)
+		{
+			return false;
+		}
+
+		if (t_section == "window")
+		{
+			if (t_key == "width" || t_key == "height")
+			{
+				return parseCount(t_value, t_key == "width" ? t_settings.windowWidth : t_settings.windowHeight);
+			}
+			return false;
+		}
+
+		if (t_section != "classic" && t_section != "custom")
+		{
+			return false;
+		}
+
+		Tuning & tuning = t_section == "classic" ? t_settings.classic : t_settings.custom; // profile being read
+
+		if (t_key == "wave_size")
+		{
+			return parseCount(t_value, tuning.waveSize);
+		}
+
+		for (const TuningKey & key : TUNING_KEYS)
+		{
+			if (t_key == key.name)
+			{
+				tuning.*key.field = t_value;
+				return true;
+			}
+		}
+
+		return false;
+	}
+}
+
+
+/// shipped classic mode balance, lasers start at 120 pixels per second, the rest is the same as custom mode
+Tuning Settings::classicTuning()
+{
+	Tuning tuning;
+	tuning.laserSpeed = 120.0f;
+	return tuning;
+}
+
+
+/// reads "key = value" lines under [section] headers over t_settings, # and ; start comments
+/// <param name="t_path">ini file</param>
+/// <param name="t_settings">defaults in, defaults with the file's values over them out</param>
+/// <returns>false if the file could not be opened, t_settings is then unchanged</returns>
+bool loadSettings(const std::string & t_path, Settings & t_settings)
+{
+	std::ifstream file{ t_path };
+	if (!file)
+	{
+		return false;
+	}
+
+	std::string line; // line being read
+	std::string section; // section of the line being read
+	unsigned lineNumber = 0u; // for reporting bad lines
+
+	while (std::getline(file, line))
+	{
+		lineNumber++;
+		line = trim(line.substr(0u, line.find_first_of("#;")));
+
+		if (line.empty())
+		{
+			continue;
+		}
+
+		if (line.front() == '[' && line.back() == ']')
+		{
+			section = trim(line.substr(1u, line.size() - 2u));
+			continue;
+		}
+
+		const std::size_t equals = line.find('='); // splits key from value
+		float value = 0.0f; // value of the key
+		if (equals == std::string::npos || !parseNumber(trim(line.substr(equals + 1u)), value)
+			|| !setKey(t_settings, section, trim(line.substr(0u, equals)), value))
+		{
+			std::cout << "settings: " << t_path << " line " << lineNumber << " ignored, \"" << line << "\"" << std::endl;
+		}
+	}
+
+	return true;
+}
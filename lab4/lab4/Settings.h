@@ -0,0 +1,47 @@
+// Author: Michal K.
+
+#ifndef SETTINGS
+#define SETTINGS
+
+#include <string>
+
+// balance constants of one game mode, defaults are the shipped custom mode
+// speeds are per second, level up values only matter in custom mode where the player levels up
+struct Tuning
+{
+	unsigned waveSize = 1u; // asteroids launched per wave
+	float asteroidSpeed = 12.0f; // asteroid speed at the start of a game, pixels per second
+	float asteroidSpeedIncrement = 12.0f; // pixels per second added to asteroid speed per asteroid shot down
+	float laserSpeed = 60.0f; // laser speed at the start of a game, pixels per second
+	float laserSpeedIncrement = 60.0f; // pixels per second added to laser speed on every level up
+	float maxLaserSpeed = 300.0f; // laser speed never goes past this
+	float powerFill = 60.0f; // power bar fill at the start of a game, power per second
+	float powerFillIncrement = 60.0f; // power per second added to the fill on every level up
+	float maxPowerFill = 600.0f; // power bar fill never goes past this
+	float maxPower = 450.0f; // max power of power bar and max altitude of laser
+	float xpGain = 50.0f; // xp gained per asteroid at the start of a game
+	float xpGainDecay = 1.1f; // xp gain per asteroid is divided by this on every level up
+	float maxXp = 100.0f; // xp needed to level up, also the length of the xp bar
+};
+
+// every tunable of the game, read once at startup by loadSettings() and never changed while playing
+// the game draws an 800 by 600 playfield, scaled to whatever window size is picked
+struct Settings
+{
+	unsigned windowWidth = 800u; // window size in pixels
+	unsigned windowHeight = 600u; // window size in pixels
+	Tuning classic = classicTuning(); // classic mode, faster lasers from the start and no levels
+	Tuning custom; // custom mode
+
+	const Tuning & profile(bool t_custom) const { return t_custom ? custom : classic; } // balance of a game mode
+
+	static Tuning classicTuning(); // shipped classic mode balance
+};
+
+// reads an ini file over t_settings, keys the file does not set keep their value
+// sections are [window], [classic] and [custom], see ASSETS/settings.ini for every key
+// values must be positive finite numbers, window sizes and wave sizes whole numbers
+// bad lines are reported and skipped, false only if the file could not be opened
+bool loadSettings(const std::string & t_path, Settings & t_settings);
+
+#endif // !SETTINGS
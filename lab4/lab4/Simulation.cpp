@@ -0,0 +1,451 @@
+// Author: Michal K.
+
+#include "Simulation.h"
+#include <iostream>
+#include "AllocationCounter.h"
+
+
+/// default constructor
+/// <param name="t_waveSize">number of asteroids launched per wave for load testing, zero uses the settings</param>
+/// <param name="t_stressTest">fire lasers every tick and check for heap allocations</param>
+/// <param name="t_seed">seed of every random number in the game world</param>
+/// <param name="t_settings">balance of classic and custom mode</param>
+Simulation::Simulation(unsigned t_waveSize, bool t_stressTest, std::uint64_t t_seed, const Settings & t_settings) :
+	m_random{ t_seed },
+	m_settings(t_settings),
+	m_stressTest{ t_stressTest },
+	m_waveSizeOverride{ t_waveSize }
+{
+	m_asteroidInterval = randomWaveInterval(); // interval between asteroid's respawn set to random number
+}
+
+
+/// random time between the end of a wave and the next launch, 1 to 100 sixtieths of a second
+float Simulation::randomWaveInterval()
+{
+	return (m_random.nextInt(100) + 1.0f) / 60.0f;
+}
+
+
+/// Update the game world
+/// every speed is per second so the game plays the same at any tick rate
+/// <param name="t_deltaTime">time interval per frame</param>
+void Simulation::update(sf::Time t_deltaTime)
+{
+	const float seconds = t_deltaTime.asSeconds(); // time simulated this tick
+
+	m_tick++; // input handled from now on belongs to the next tick
+	m_tickArena.reset(); // nothing from the last tick is still in use
+
+	if (m_currentGameState == mainMenu) // if main menu is current game screen
+	{
+		resetAttributes(); // reset player stats such as xp, score, laser speed, etc. to default values
+	}
+
+	if (m_stressTest) // stress test plays on its own
+	{
+		stressTest();
+	}
+
+	// a mode was just picked, its balance applies from this tick on
+	if ((m_currentGameState == classicMode || m_currentGameState == customMode) && !m_gameStarted)
+	{
+		startGame();
+	}
+
+	// if classic mode or custom mode is currently played
+	if (m_currentGameState == classicMode || m_currentGameState == customMode)
+	{
+		const std::size_t allocationsBefore = threadAllocationCount(); // to check lasers and asteroids do not allocate
+		const double tickStart = m_time; // events are scheduled from the start of the tick
+
+		// systems run in this order, see Systems.h
+		explosionSystem(m_world, seconds); // explosions grow, finished ones are removed after the collisions
+		laserFlightSystem(m_world, seconds); // every laser's path to mouse click and explosion is animated
+
+		if (m_currentAsteroidState == launch) // asteroid wave is about to launch
+		{
+			asteroidProperties(); // sets start and end point's of every asteroid and gets their direction
+			m_currentAsteroidState = flight; // asteroids are moving to their destination
+		}
+
+		if (m_currentAsteroidState == flight) // if asteroids are moving
+		{
+			animateAsteroid(seconds); // collisions, then every asteroid's path to its destination is animated
+		}
+
+		finishedExplosionSystem(m_world); // explosions that reached their max radius had this tick's collisions
+
+		m_stressAllocations += threadAllocationCount() - allocationsBefore;
+
+		animatePowerBar(seconds); // animates power bar's growth
+
+		m_time = tickStart + seconds;
+		processDueEvents(); // next wave launches once its interval has passed
+	}
+}
+
+
+/// whole ticks that can be skipped because nothing but straight line movement happens before the next event
+/// explosions are the only thing that can hit an asteroid, so none may be alive, input ends a skip as well
+/// the tick the next event falls in is always left for update()
+/// <param name="t_timePerTick">fixed timestep the ticks would have used</param>
+std::uint32_t Simulation::ticksUntilNextEvent(sf::Time t_timePerTick) const
+{
+	if ((m_currentGameState != classicMode && m_currentGameState != customMode) || m_stressTest
+		|| m_currentAsteroidState == launch || m_events.empty())
+	{
+		return 0u;
+	}
+
+	const ComponentPool<Lifetime> & lifetimes = m_world.lifetimes(); // every laser and explosion
+	for (std::size_t i = 0u; i < lifetimes.size(); i++)
+	{
+		if (lifetimes[i].stage == Lifetime::explosion) // may hit an asteroid on any tick
+		{
+			return 0u;
+		}
+	}
+
+	const double ticks = (m_events.next().time - m_time) / t_timePerTick.asSeconds(); // ticks until next event
+	return ticks > 2.0 ? static_cast<std::uint32_t>(ticks) - 1u : 0u;
+}
+
+
+/// jumps t_ticks ticks at once, only valid up to ticksUntilNextEvent()
+/// lasers, asteroids and the power bar are moved as one long step, nothing else can change in between
+void Simulation::skipTicks(std::uint32_t t_ticks, sf::Time t_timePerTick)
+{
+	const float seconds = t_timePerTick.asSeconds() * t_ticks; // time skipped
+
+	m_tick += t_ticks;
+	laserFlightSystem(m_world, seconds); // only firing lasers, none arrives before the next event
+
+	if (m_currentAsteroidState == flight)
+	{
+		movementSystem(m_world, seconds); // no asteroid reaches the ground before the next event
+	}
+
+	animatePowerBar(seconds);
+	m_time += static_cast<double>(t_timePerTick.asSeconds()) * t_ticks;
+}
+
+
+/// every asteroid of the wave collided with something, next one launches after a random interval
+/// <param name="t_time">when the last asteroid collided, within the tick rather than at its start</param>
+void Simulation::waveOver(double t_time)
+{
+	m_currentAsteroidState = collision;
+	m_events.schedule(t_time + m_asteroidInterval, EventScheduler::waveLaunch);
+}
+
+
+/// handles every scheduled event up to the current time
+/// impacts and arrivals are detected exactly by the swept tests, their events only mark when skipping must stop
+void Simulation::processDueEvents()
+{
+	bool groundImpactDue = false; // an impact time passed, the asteroid may have been shot down
+
+	while (!m_events.empty() && m_events.next().time <= m_time)
+	{
+		const EventScheduler::Event event = m_events.pop(); // earliest event
+
+		if (event.type == EventScheduler::waveLaunch && m_currentAsteroidState == collision)
+		{
+			m_launchTime = event.time; // launched a fraction of a tick late, see asteroidProperties()
+			m_asteroidInterval = randomWaveInterval(); // interval number randomized
+			asteroidProperties(); // launched now rather than next tick, so input sees it as soon as at any other rate
+			m_currentAsteroidState = flight;
+		}
+
+		groundImpactDue = groundImpactDue || event.type == EventScheduler::groundImpact;
+	}
+
+	if (groundImpactDue && m_currentAsteroidState == flight) // wave still flying, next asteroid to land takes over
+	{
+		scheduleGroundImpact();
+	}
+}
+
+
+/// handle key presses and mouse clicks for the current game state
+/// window events are passed in by Game, drivers without a window can pass their own
+void Simulation::processEvent(const sf::Event & t_event)
+{
+	if (sf::Event::KeyPressed == t_event.type) //user key press
+	{
+		if (sf::Keyboard::Escape == t_event.key.code)
+		{
+			m_exitGame = true;
+		}
+	}
+
+	// only do in classic or custom mode
+	if (m_currentGameState == classicMode || m_currentGameState == customMode)
+	{
+		if (sf::Event::MouseButtonPressed == t_event.type) // every click fires while a laser is free
+		{
+			processMouseEvents(t_event);
+		}
+	}
+
+	if (m_currentGameState == mainMenu) // if main menu is the current game screen
+	{
+		if (sf::Event::KeyPressed == t_event.type)
+		{
+			// checks if either number 1 is pressed (num1 or numpad1)
+			if (sf::Keyboard::Num1 == t_event.key.code || sf::Keyboard::Numpad1 == t_event.key.code)
+			{
+				m_currentGameState = classicMode; // game mode is set to classic mode
+			}
+
+			// checks if either number 2 is pressed (num2 or numpad2)
+			if (sf::Keyboard::Num2 == t_event.key.code || sf::Keyboard::Numpad2 == t_event.key.code)
+			{
+				m_currentGameState = customMode; // game mode is set to classic mode
+			}
+		}
+	}
+
+	if (m_currentGameState == gameOver) // if game is over
+	{
+		if (sf::Event::KeyPressed == t_event.type)
+		{
+			if (sf::Keyboard::Space == t_event.key.code)
+			{
+				m_currentGameState = mainMenu; // return to main menu screen
+			}
+		}
+	}
+}
+
+
+/// checks if left mouse button has been clicked
+/// fires a laser at the mouse click, position comes with the event so no window is needed
+void Simulation::processMouseEvents(sf::Event t_mouseEvents)
+{
+	if (sf::Mouse::Left == t_mouseEvents.mouseButton.button) // if left mouse button clicked
+	{
+		// static cast mouse x and y coordinate into a vector
+		fireLaser(sf::Vector2f(static_cast<float>(t_mouseEvents.mouseButton.x), static_cast<float>(t_mouseEvents.mouseButton.y)));
+	}
+}
+
+
+/// fires a laser from the base using current power
+/// max altitude of laser is based on current power, power bar is emptied by every shot
+void Simulation::fireLaser(sf::Vector2f t_destination)
+{
+	float altitude = GROUND_TOP - m_currentPower; // calculate altitude
+
+	const Entity laser = m_world.spawnLaser(m_laserStartPoint, t_destination, m_laserSpeed, altitude);
+
+	if (laser != NO_ENTITY) // only if a laser was free
+	{
+		m_currentPower = 0.0f; // reset power of power bar
+
+		// laser flies straight up to whichever it reaches first, destination or altitude
+		const float stopHeight = m_world.lifetimes().get(laser).stopHeight;
+		const float tipHeight = m_world.transforms().get(laser).tipPoint.y;
+		const sf::Vector2f velocity = m_world.velocities().get(laser).perSecond;
+		const double arrival = velocity.y < 0.0f && tipHeight > stopHeight
+			? m_time + (stopHeight - tipHeight) / velocity.y : m_time;
+
+		m_events.schedule(arrival, EventScheduler::laserArrival);
+		m_events.schedule(arrival + World::MAX_EXPLOSION_RADIUS / World::EXPLOSION_GROWTH, EventScheduler::explosionEnd);
+	}
+}
+
+
+/// fires lasers at random points every tick, no input needed
+/// heap allocations made by lasers and asteroids are reported every 600 ticks, steady state must make none
+void Simulation::stressTest()
+{
+	if (m_currentGameState == gameOver) // keep playing forever, main menu resets the game
+	{
+		m_currentGameState = mainMenu;
+		return;
+	}
+
+	if (m_currentGameState == mainMenu) // game was reset, start playing again
+	{
+		m_currentGameState = classicMode;
+		return;
+	}
+
+	for (int shot = 0; shot < 4; shot++) // burst of shots every tick
+	{
+		m_currentPower = m_tuning->maxPower; // scripted shots always reach their destination
+		fireLaser(sf::Vector2f{ static_cast<float>(m_random.nextInt(800)), static_cast<float>(m_random.nextInt(440)) });
+	}
+
+	m_stressTicks++;
+	if (m_stressTicks % 600 == 0) // every ten seconds
+	{
+		std::cout << "stress test: " << m_world.laserCount() << " lasers alive, "
+			<< m_stressAllocations << " heap allocations in last 600 ticks" << std::endl;
+
+		if (m_stressTicks > 600 && m_stressAllocations != 0u) // first report includes warm up
+		{
+			std::cout << "stress test: steady state update loop allocated memory" << std::endl;
+		}
+
+		m_stressAllocations = 0u;
+	}
+}
+
+
+/// power bar is filled based on power increment
+void Simulation::animatePowerBar(float t_seconds)
+{
+	if (m_currentPower >= m_tuning->maxPower) // if max power reached
+	{
+		m_currentPower = m_tuning->maxPower; // limit power
+	}
+
+	else
+	{
+		m_currentPower += m_powerInc * t_seconds; // increase power
+	}
+}
+
+
+/// launches a wave of asteroids with random start and end positions
+/// direction and velocity of every asteroid is set in one batch
+/// a wave is due within a tick but launched at its end, it is moved on by the time since it was due
+/// so every tick rate launches it from the same place at the same time
+void Simulation::asteroidProperties()
+{
+	m_world.spawnAsteroids(m_waveSize, m_asteroidSpeed, WIDTH, HEIGHT, m_random, m_tickArena);
+	movementSystem(m_world, static_cast<float>(m_time - m_launchTime)); // only the wave just spawned moves
+	scheduleGroundImpact();
+}
+
+
+/// every asteroid flies in a straight line, first one to reach the ground decides the impact time
+void Simulation::scheduleGroundImpact()
+{
+	const ComponentPool<Collider> & colliders = m_world.colliders(); // asteroids and explosions
+	double impact = -1.0; // seconds from now until the first asteroid reaches the ground
+
+	for (std::size_t i = 0u; i < colliders.size(); i++)
+	{
+		if (colliders[i].layer != Collider::asteroid) // explosions never land
+		{
+			continue;
+		}
+
+		const Entity asteroid = colliders.entity(i);
+		const sf::Vector2f velocity = m_world.velocities().get(asteroid).perSecond;
+
+		if (velocity.y > 0.0f)
+		{
+			const double seconds = (GROUND_TOP - m_world.transforms().get(asteroid).tipPoint.y) / velocity.y; // time to ground
+			impact = impact < 0.0 || seconds < impact ? seconds : impact;
+		}
+	}
+
+	if (impact >= 0.0)
+	{
+		m_events.schedule(m_time + impact, EventScheduler::groundImpact);
+	}
+}
+
+
+/// every asteroid's journey from random start point to random end point is animated
+/// if any destination is reached, game over
+/// once the whole wave is shot down, respawn
+void Simulation::animateAsteroid(float t_seconds)
+{
+	const double collisionTime = collisionDetection(t_seconds); // shot down asteroids are removed
+
+	if (m_world.asteroidCount() == 0u && m_currentGameState != gameOver) // whole wave shot down, a landed wave ends the game instead
+	{
+		waveOver(collisionTime);
+	}
+
+	movementSystem(m_world, t_seconds); // every end point updated with velocity
+}
+
+
+/// checks for collisions of every asteroid over the whole tick, before asteroids are moved, see CollisionSystem
+/// every asteroid shot down scores, an asteroid reaching the ground ends the game
+/// <returns>time of the last collision this tick</returns>
+double Simulation::collisionDetection(float t_seconds)
+{
+	const CollisionSystem::Result collisions = m_collisionSystem.update(m_world, t_seconds, m_tickArena);
+	const double collisionTime = m_time + static_cast<double>(collisions.lastTime) * t_seconds; // m_time is the tick's start
+
+	if (collisions.groundReached) // every asteroid was removed
+	{
+		m_currentAsteroidState = collision; // asteroid's collision detected, no wave follows it
+		m_currentGameState = gameOver; // game is over
+		return collisionTime;
+	}
+
+	for (std::size_t i = 0u; i < collisions.shotDown; i++)
+	{
+		m_asteroidSpeed += m_tuning->asteroidSpeedIncrement; // asteroid animation speed is increased
+		m_score += 1 * m_playerLvl; // add score to player, multiplier increases score gained per player level
+		m_xp += m_playerXpGain; // player gains xp
+
+		if (m_currentGameState == customMode) // if custom mode is played
+		{
+			if (m_xp >= m_tuning->maxXp) // if player is eligible for a level up
+			{
+				levelUp(); // increases player level and improves players stats
+			}
+		}
+	}
+
+	return collisionTime;
+}
+
+
+/// level up player, reduce xp gain per asteroid shot down and improved laser's speed
+void Simulation::levelUp()
+{
+	m_playerLvl++; // level increased by 1
+	m_playerXpGain /= m_tuning->xpGainDecay; // reduced player xp gain
+	m_xp = 0.0f; // reset current player xp
+	m_powerInc += m_tuning->powerFillIncrement; // power bar fills up faster
+	m_laserSpeed += m_tuning->laserSpeedIncrement; // laser speed improved
+
+	if (m_laserSpeed >= m_tuning->maxLaserSpeed) // if max laser speed
+	{
+		m_laserSpeed = m_tuning->maxLaserSpeed; // limit laser speed
+	}
+
+	if (m_powerInc >= m_tuning->maxPowerFill) // if max power increment speed
+	{
+		m_powerInc = m_tuning->maxPowerFill; // limit power increment speed
+	}
+}
+
+
+/// reset player stats such as xp, score, laser speed, etc. to default values
+void Simulation::resetAttributes()
+{
+	m_playerLvl = 1; // player level rest
+	m_xp = 0.0f; // xp reset
+	m_score = 0; // score reset
+	m_currentPower = 0.0f; // current power reset
+	m_gameStarted = false; // speeds and xp gain are set once a mode is picked
+	m_world.clear(); // no asteroids or lasers left over from last game
+	m_events.clear(); // nothing left to happen from last game
+	m_currentAsteroidState = launch; // new game starts with a wave
+	m_launchTime = m_time; // on the first tick played, menus do not count
+}
+
+
+/// speeds, xp gain and wave size of the mode just picked, from its balance in the settings
+void Simulation::startGame()
+{
+	m_tuning = &m_settings.profile(m_currentGameState == customMode);
+	m_playerXpGain = m_tuning->xpGain; // xp gain reset
+	m_asteroidSpeed = m_tuning->asteroidSpeed; // speed reset
+	m_laserSpeed = m_tuning->laserSpeed; // laser speed reset
+	m_powerInc = m_tuning->powerFill; // power bar increment reset
+	m_waveSize = m_waveSizeOverride > 0u ? m_waveSizeOverride : m_tuning->waveSize;
+	m_gameStarted = true;
+}
@@ -0,0 +1,117 @@
+// Author: Michal K.
+
+#ifndef SIMULATION
+#define SIMULATION
+
+#include <SFML/Window.hpp>
+#include "World.h"
+#include "Systems.h"
+#include "Random.h"
+#include "EventScheduler.h"
+#include "Settings.h"
+
+// game world without a window, everything update() changes lives here
+// Game draws it and feeds it window events, a headless driver can step it as fast as the cpu allows
+class Simulation
+{
+public:
+	static constexpr float WIDTH = 800.0f; // playfield width
+	static constexpr float HEIGHT = 600.0f; // playfield height
+	static constexpr float GROUND_TOP = 500.0f; // y coordinate of top of the ground
+	static constexpr float BASE_CENTRE = 400.0f; // x coordinate of middle of the base, lasers start here
+
+	enum m_gameState { mainMenu, classicMode, customMode, gameOver }; // all possible states of game
+
+	// t_waveSize overrides the asteroids per wave of both modes unless zero
+	Simulation(unsigned t_waveSize = 0u, bool t_stressTest = false, std::uint64_t t_seed = 0u, const Settings & t_settings = Settings{});
+
+	void update(sf::Time t_deltaTime); // Update the game world
+	void processEvent(const sf::Event & t_event); // key presses and mouse clicks for current game state
+	void fireLaser(sf::Vector2f t_destination); // fires a laser from the base using current power
+	void setGameState(m_gameState t_gameState) { m_currentGameState = t_gameState; } // for drivers without input
+
+	// whole ticks that can be skipped before the next scheduled event, zero while anything needs checking every tick
+	std::uint32_t ticksUntilNextEvent(sf::Time t_timePerTick) const;
+	void skipTicks(std::uint32_t t_ticks, sf::Time t_timePerTick); // jumps ticksUntilNextEvent() ticks or fewer at once
+
+	m_gameState gameState() const { return m_currentGameState; } // current game state
+	std::uint32_t tick() const { return m_tick; } // number of updates so far, input is recorded against it
+	double time() const { return m_time; } // seconds of play so far
+	bool exitRequested() const { return m_exitGame; } // escape was pressed
+	int score() const { return m_score; } // current player score
+	int playerLvl() const { return m_playerLvl; } // current player level
+	float xp() const { return m_xp; } // current player xp
+	float currentPower() const { return m_currentPower; } // current power of power bar
+	float laserSpeed() const { return m_laserSpeed; } // speed of the next laser fired, pixels per second
+	const Tuning & tuning() const { return *m_tuning; } // balance of the mode being played, or last played
+	const World & world() const { return m_world; } // every asteroid, laser and explosion alive
+
+private:
+
+	// functions
+	float randomWaveInterval(); // seconds between the end of a wave and the next launch
+	void processMouseEvents(sf::Event t_mouseEvent); // checks if left mouse button has been clicked
+	void stressTest(); // fires lasers every tick and checks that no heap allocations are made
+	void animatePowerBar(float t_seconds); // power bar is filled based on power increment
+	void asteroidProperties(); // launches a wave of asteroids with random start and end positions
+	void scheduleGroundImpact(); // schedules when the first asteroid of the wave reaches the ground
+	void waveOver(double t_time); // schedules the launch of the next wave, t_time is when the wave ended
+	void processDueEvents(); // handles every scheduled event up to the current time
+	void animateAsteroid(float t_seconds); // every asteroid's journey from random start point to random end point is animated
+	double collisionDetection(float t_seconds); // checks for collisions of every asteroid and scores the ones shot down
+	void levelUp(); // level up player, reduce xp gain per asteroid shot down and improved laser's speed
+	void resetAttributes(); // reset player stats such as xp, score, laser speed, etc. to default values
+	void startGame(); // speeds and xp gain of the mode just picked, on the first tick it is played
+
+
+	// variables
+	bool m_exitGame{ false }; // control exiting game
+	std::uint32_t m_tick = 0u; // number of updates so far
+	double m_time = 0.0; // seconds of play so far, menus do not count
+	EventScheduler m_events; // impacts, arrivals and launches coming up
+	Random m_random; // every random number of the game world, same seed gives same game
+
+	int m_score = 0; // current player score
+	int m_playerLvl = 1; // current player level
+	float m_xp = 0.0f; // experience points earned by shooting down asteroids
+	float m_playerXpGain = 50.0f; // current xp gain from shooting down asteroids
+
+	const Settings m_settings; // balance of every mode, never changes
+	const Tuning * m_tuning = &m_settings.classic; // balance of the mode being played, set by startGame()
+	bool m_gameStarted{ false }; // startGame() ran since the last reset
+	float m_currentPower = 0.0f; // current power of power bar and altitude of laser
+	float m_powerInc = 60.0f; // power bar increment per second
+
+
+	// laser variables
+	sf::Vector2f m_laserStartPoint{ BASE_CENTRE, GROUND_TOP }; // start position of laser at base
+	float m_laserSpeed = 60.0f; // speed of laser's animation, pixels per second
+
+	bool m_stressTest{ false }; // fire lasers every tick and count heap allocations
+	int m_stressTicks = 0; // ticks played in stress test
+	std::size_t m_stressAllocations = 0u; // heap allocations made by lasers and asteroids since last report
+
+
+	// asteroid variables
+	const unsigned m_waveSizeOverride = 0u; // asteroids per wave from the command line, zero uses the mode's balance
+	unsigned m_waveSize = 1u; // number of asteroids launched per wave
+	float m_asteroidSpeed = 24.0f; // speed of asteroid's animation, pixels per second
+	float  m_asteroidInterval = 0.0f; // random interval between each wave launch, seconds
+	double m_launchTime = 0.0; // time the wave was due, it launches at the end of that tick and is moved on by the difference
+
+
+	// entities, moved by the systems in Systems.h
+	World m_world; // every asteroid, laser and explosion currently alive
+	CollisionSystem m_collisionSystem{ WIDTH, HEIGHT, GROUND_TOP }; // explosion vs asteroid and asteroid vs ground
+	FrameArena m_tickArena; // spawn lists and collision arrays, emptied at the start of every update()
+
+
+	// state machines
+	enum m_asteroidState {launch, flight, collision}; // all possible states of asteroid wave
+	m_asteroidState m_currentAsteroidState = launch; // current asteroid wave state
+
+	m_gameState m_currentGameState = mainMenu; // current game state
+
+};
+
+#endif // !SIMULATION
@@ -0,0 +1,103 @@
+// Author: Michal K.
+
+#include "SimulationThread.h"
+
+
+/// <param name="t_simulation">simulation to run, must not be touched by anyone else until stop()</param>
+/// <param name="t_recorder">user and source events are recorded here, may be closed</param>
+/// <param name="t_source">replay or AI gunner driving the simulation instead of the user, null for none</param>
+/// <param name="t_timePerTick">fixed timestep</param>
+SimulationThread::SimulationThread(Simulation & t_simulation, InputRecorder & t_recorder, InputSource * t_source, sf::Time t_timePerTick) :
+	m_simulation(t_simulation),
+	m_recorder(t_recorder),
+	m_source(t_source),
+	m_timePerTick{ t_timePerTick }
+{
+	m_pendingEvents.reserve(64u);
+	m_handledEvents.reserve(64u);
+}
+
+
+/// stops the thread
+SimulationThread::~SimulationThread()
+{
+	stop();
+}
+
+
+/// publishes the state before the first tick so the renderer has something to draw, then starts ticking
+void SimulationThread::start()
+{
+	if (m_running.exchange(true))
+	{
+		return;
+	}
+
+	m_snapshots.back().capture(m_simulation);
+	m_snapshots.publish();
+	m_thread = std::thread{ &SimulationThread::run, this };
+}
+
+
+/// waits for the current tick to finish, the simulation can be used again afterwards
+void SimulationThread::stop()
+{
+	m_running.store(false);
+
+	if (m_thread.joinable())
+	{
+		m_thread.join();
+	}
+}
+
+
+/// window thread, the event is handed to the simulation before the next tick
+void SimulationThread::pushEvent(const sf::Event & t_event)
+{
+	std::lock_guard<std::mutex> lock{ m_eventMutex };
+	m_pendingEvents.push_back(t_event);
+}
+
+
+/// same fixed timestep catch-up as Game::run, sleeps until the next tick is due
+void SimulationThread::run()
+{
+	sf::Clock clock;
+	sf::Time timeSinceLastUpdate = sf::Time::Zero;
+
+	while (m_running.load())
+	{
+		timeSinceLastUpdate += clock.restart();
+
+		if (timeSinceLastUpdate > m_timePerTick)
+		{
+			while (timeSinceLastUpdate > m_timePerTick)
+			{
+				timeSinceLastUpdate -= m_timePerTick;
+
+				{
+					std::lock_guard<std::mutex> lock{ m_eventMutex };
+					m_handledEvents.swap(m_pendingEvents);
+				}
+
+				for (const sf::Event & event : m_handledEvents)
+				{
+					feedUserEvent(m_simulation, m_recorder, m_source, event);
+				}
+				m_handledEvents.clear();
+
+				if (m_source != nullptr)
+				{
+					feedSourceEvents(m_simulation, *m_source, m_recorder);
+				}
+				m_simulation.update(m_timePerTick);
+				m_ticks.fetch_add(1u, std::memory_order_relaxed);
+			}
+
+			m_snapshots.back().capture(m_simulation); // only the newest state is worth drawing
+			m_snapshots.publish();
+		}
+
+		sf::sleep(m_timePerTick - timeSinceLastUpdate); // until the next tick is due
+	}
+}
@@ -0,0 +1,49 @@
+// Author: Michal K.
+
+#ifndef SIMULATION_THREAD
+#define SIMULATION_THREAD
+
+#include <SFML/System.hpp>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "Simulation.h"
+#include "Snapshot.h"
+#include "InputRecording.h"
+
+// runs the fixed timestep simulation on its own thread, independent of how long rendering takes
+// user events are queued from the window thread and handed over before the next tick
+// after every catch-up the newest state is published to snapshots() for the renderer
+class SimulationThread
+{
+public:
+	SimulationThread(Simulation & t_simulation, InputRecorder & t_recorder, InputSource * t_source, sf::Time t_timePerTick);
+	~SimulationThread(); // stops the thread
+
+	void start(); // publishes the first snapshot and starts ticking
+	void stop(); // waits for the current tick to finish
+
+	void pushEvent(const sf::Event & t_event); // window thread, handled before the next tick
+	SnapshotBuffer & snapshots() { return m_snapshots; } // renderer reads front() after acquire()
+	std::uint32_t ticks() const { return m_ticks.load(std::memory_order_relaxed); } // ticks run since start
+
+private:
+	void run(); // thread body
+
+	Simulation & m_simulation; // only touched by the thread while running
+	InputRecorder & m_recorder; // user events are recorded on the thread as they are handled
+	InputSource * m_source; // replay or AI gunner, its events are made and handed over on the thread, null for the user
+	sf::Time m_timePerTick; // fixed timestep
+
+	SnapshotBuffer m_snapshots; // lock free hand over to the renderer
+	std::mutex m_eventMutex; // guards m_pendingEvents
+	std::vector<sf::Event> m_pendingEvents; // queued by pushEvent()
+	std::vector<sf::Event> m_handledEvents; // swapped with m_pendingEvents so the lock is held briefly
+	std::atomic<bool> m_running{ false }; // cleared to stop the thread
+	std::atomic<std::uint32_t> m_ticks{ 0u }; // ticks run since start
+	std::thread m_thread; // runs run()
+};
+
+#endif // !SIMULATION_THREAD
@@ -0,0 +1,76 @@
+// Author: Michal K.
+
+#include "Snapshot.h"
+
+
+/// copies everything the renderer needs, nothing is allocated once the sprite vector has grown
+void Snapshot::capture(const Simulation & t_simulation)
+{
+	const World & world = t_simulation.world(); // every asteroid, laser and explosion alive
+	const ComponentPool<Renderable> & renderables = world.renderables(); // everything drawn
+
+	tick = t_simulation.tick();
+	gameState = t_simulation.gameState();
+	exitRequested = t_simulation.exitRequested();
+	score = t_simulation.score();
+	playerLvl = t_simulation.playerLvl();
+	xp = t_simulation.xp() * 100.0f / t_simulation.tuning().maxXp; // bar is 100 pixels at any max xp
+	currentPower = t_simulation.currentPower() * 450.0f / t_simulation.tuning().maxPower; // bar is 450 pixels at any max power
+
+	sprites.resize(renderables.size());
+	for (std::size_t i = 0u; i < renderables.size(); i++)
+	{
+		const Entity entity = renderables.entity(i);
+		const Transform & transform = world.transforms().get(entity);
+		Sprite & sprite = sprites[i];
+
+		sprite.entity = entity;
+		sprite.shape = renderables[i].shape;
+		sprite.startPoint = transform.startPoint;
+		sprite.tipPoint = transform.tipPoint;
+		sprite.radius = world.colliders().has(entity) ? world.colliders().get(entity).radius : 0.0f;
+	}
+}
+
+
+/// this becomes t_current with projectiles moved t_alpha of the way from where they were in t_previous
+/// a projectile is only moved if it is the same one in the same slot of both, same entity, shape and start point
+/// entity ids are reused, the start point tells a new projectile from the one that had its id before
+/// <param name="t_alpha">0 shows t_previous, 1 shows t_current</param>
+void Snapshot::interpolate(const Snapshot & t_previous, const Snapshot & t_current, float t_alpha)
+{
+	*this = t_current;
+
+	for (std::size_t i = 0u; i < sprites.size() && i < t_previous.sprites.size(); i++)
+	{
+		const Sprite & before = t_previous.sprites[i]; // same slot one snapshot earlier
+		Sprite & now = sprites[i];
+
+		if (before.entity == now.entity && before.shape == now.shape && before.startPoint == now.startPoint)
+		{
+			now.tipPoint = before.tipPoint + (now.tipPoint - before.tipPoint) * t_alpha;
+			now.radius = before.radius + (now.radius - before.radius) * t_alpha;
+		}
+	}
+}
+
+
+/// back() becomes the newest snapshot and the writer gets the slot the reader is not using
+void SnapshotBuffer::publish()
+{
+	m_back = m_middle.exchange(static_cast<std::uint8_t>(m_back | FRESH), std::memory_order_acq_rel) & INDEX_MASK;
+}
+
+
+/// swaps front() for the newest published snapshot if there is one
+/// <returns>true if front() changed</returns>
+bool SnapshotBuffer::acquire()
+{
+	if ((m_middle.load(std::memory_order_relaxed) & FRESH) == 0u)
+	{
+		return false;
+	}
+
+	m_front = m_middle.exchange(m_front, std::memory_order_acq_rel) & INDEX_MASK;
+	return true;
+}
@@ -0,0 +1,66 @@
+// Author: Michal K.
+
+#ifndef SNAPSHOT
+#define SNAPSHOT
+
+#include <SFML/System.hpp>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+#include "Simulation.h"
+
+// one entity as the renderer draws it
+struct Sprite
+{
+	Entity entity = NO_ENTITY; // entity drawn, only the same entity is moved between two snapshots
+	Renderable::Shape shape = Renderable::trail; // line from start point to tip, or ring around the tip
+	sf::Vector2f startPoint{ 0.0f, 0.0f }; // start of the trail
+	sf::Vector2f tipPoint{ 0.0f, 0.0f }; // end of the trail, centre of the ring
+	float radius = 0.0f; // radius of the ring
+};
+
+// copy of everything the renderer needs from the simulation after one tick
+// the renderer only ever reads snapshots so the simulation can keep running on another thread
+struct Snapshot
+{
+	std::uint32_t tick = 0u; // simulation tick the snapshot was taken after
+	Simulation::m_gameState gameState = Simulation::mainMenu; // screen to draw
+	bool exitRequested = false; // escape was pressed
+	int score = 0; // player score
+	int playerLvl = 1; // player level
+	float xp = 0.0f; // width of xp bar, 100 when the next level is reached
+	float currentPower = 0.0f; // width of power bar, 450 at max power
+
+	std::vector<Sprite> sprites; // every asteroid, laser and explosion alive
+
+	void capture(const Simulation & t_simulation); // copies the simulation, vector capacity is reused
+
+	// this becomes t_current with projectiles moved t_alpha (0 - 1) of the way from where they were in t_previous
+	void interpolate(const Snapshot & t_previous, const Snapshot & t_current, float t_alpha);
+};
+
+
+// three snapshots shared by one writer and one reader without locks
+// the writer fills back() and publishes it, the reader acquires the newest published one as front()
+// neither side ever waits for the other and the reader never sees a snapshot that is being written
+class SnapshotBuffer
+{
+public:
+	Snapshot & back() { return m_slots[m_back]; } // writer only, slot to fill
+	void publish(); // writer only, back() becomes the newest snapshot
+
+	bool acquire(); // reader only, true if a newer snapshot was published since the last call
+	const Snapshot & front() const { return m_slots[m_front]; } // reader only, newest acquired snapshot
+
+private:
+	static const std::uint8_t INDEX_MASK = 3u; // slot index bits of m_middle
+	static const std::uint8_t FRESH = 4u; // m_middle holds a snapshot the reader has not seen
+
+	std::array<Snapshot, 3> m_slots; // back, middle and front
+	std::uint8_t m_back = 0u; // slot being written
+	std::atomic<std::uint8_t> m_middle{ 1u }; // slot handed between writer and reader, plus FRESH flag
+	std::uint8_t m_front = 2u; // slot being read
+};
+
+#endif // !SNAPSHOT
@@ -0,0 +1,148 @@
+// Author: Michal K.
+
+#include "SoakMonitor.h"
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include "AllocationCounter.h"
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <psapi.h>
+#ifdef _MSC_VER
+#pragma comment(lib, "psapi.lib")
+#endif
+#else
+#include <unistd.h>
+#endif
+
+
+namespace
+{
+	/// bytes of the process held in physical memory, zero where the platform does not say
+	std::size_t residentBytes()
+	{
+#ifdef _WIN32
+		PROCESS_MEMORY_COUNTERS counters;
+		if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+		{
+			return counters.WorkingSetSize;
+		}
+		return 0u;
+#else
+		std::ifstream statm{ "/proc/self/statm" }; // linux, total then resident pages
+		std::size_t pages = 0u;
+		std::size_t residentPages = 0u;
+		if (statm >> pages >> residentPages)
+		{
+			return residentPages * static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+		}
+		return 0u;
+#endif
+	}
+
+	/// bytes to mebibytes for printing
+	double mebibytes(std::size_t t_bytes)
+	{
+		return t_bytes / (1024.0 * 1024.0);
+	}
+}
+
+
+/// default constructor
+/// <param name="t_reportMinutes">minutes of game time between reports</param>
+/// <param name="t_timePerTick">simulation's fixed step</param>
+SoakMonitor::SoakMonitor(float t_reportMinutes, sf::Time t_timePerTick) :
+	m_tickSeconds{ t_timePerTick.asSeconds() },
+	m_reportTicks{ std::max(1u, static_cast<std::uint32_t>(t_reportMinutes * 60.0f / t_timePerTick.asSeconds())) },
+	m_nextReport{ m_reportTicks },
+	m_allocations{ allocationCount() }
+{
+}
+
+
+/// counts finished games, prints a report whenever another interval of ticks has passed
+/// sampled once a frame, a game over shown for a single tick of a threaded run may be missed
+void SoakMonitor::sample(std::uint32_t t_tick, Simulation::m_gameState t_state, int t_score, int t_level, const Profiler & t_profiler)
+{
+	if (t_state == Simulation::gameOver && m_state != Simulation::gameOver) // game just ended, score is still shown
+	{
+		m_games++;
+		m_intervalGames++;
+		m_intervalScore += t_score;
+		m_bestScore = std::max(m_bestScore, t_score);
+		m_bestLevel = std::max(m_bestLevel, t_level);
+	}
+	m_state = t_state;
+
+	if (t_tick >= m_nextReport)
+	{
+		report(t_tick, t_profiler);
+		m_nextReport = t_tick + m_reportTicks;
+	}
+}
+
+
+/// game and wall clock time, games, heap allocations and memory since the last report, frame times of the profiler's window
+void SoakMonitor::report(std::uint32_t t_tick, const Profiler & t_profiler)
+{
+	const std::size_t resident = residentBytes();
+	const std::size_t allocations = allocationCount(); // every thread, after reading the memory so that is not counted
+
+	if (m_reports == 0u)
+	{
+		m_firstResident = resident;
+	}
+	m_peakResident = std::max(m_peakResident, resident);
+	m_reports++;
+
+	const std::streamsize precision = std::cout.precision(); // put back for everything else printed
+
+	std::cout << std::fixed << std::setprecision(1) << "soak: " << t_tick * m_tickSeconds / 60.0f << " min of play in "
+		<< m_clock.getElapsedTime().asSeconds() / 60.0f << " min, " << m_intervalGames << " games over";
+	if (m_intervalGames > 0u)
+	{
+		std::cout << " scoring " << static_cast<double>(m_intervalScore) / m_intervalGames << " on average";
+	}
+	std::cout << " (" << m_games << " in all, best score " << m_bestScore << ", best level " << m_bestLevel << "), "
+		<< allocations - m_allocations << " heap allocations, "
+		<< t_profiler.allocatingFrames() - m_allocatingFrames << " allocating frames, ";
+	if (resident > 0u)
+	{
+		std::cout << "resident " << mebibytes(resident) << " MiB (" << std::showpos << mebibytes(resident) - mebibytes(m_firstResident)
+			<< std::noshowpos << " since the first report), ";
+	}
+	std::cout << std::setprecision(2) << "frame p50 " << t_profiler.percentile(Profiler::PHASE_COUNT, 50.0f)
+		<< " p99 " << t_profiler.percentile(Profiler::PHASE_COUNT, 99.0f) << " ms" << std::defaultfloat << std::setprecision(precision) << std::endl;
+
+	m_allocations = allocations;
+	m_allocatingFrames = t_profiler.allocatingFrames();
+	m_intervalGames = 0u;
+	m_intervalScore = 0;
+}
+
+
+/// resident memory at the first report against the last, a leak grows it every interval
+void SoakMonitor::finish()
+{
+	const std::size_t resident = residentBytes();
+
+	if (m_reports == 0u || resident == 0u) // run too short for a report, or memory is not known
+	{
+		std::cout << "soak: " << m_games << " games over, best score " << m_bestScore << ", best level " << m_bestLevel << std::endl;
+		return;
+	}
+
+	const std::streamsize precision = std::cout.precision(); // put back for everything else printed
+	std::cout << std::fixed << std::setprecision(1) << "soak: " << m_games << " games over, best score " << m_bestScore
+		<< ", best level " << m_bestLevel << ", resident " << mebibytes(m_firstResident) << " MiB at the first report, "
+		<< mebibytes(resident) << " MiB at the end, " << mebibytes(std::max(m_peakResident, resident)) << " MiB at most"
+		<< std::defaultfloat << std::setprecision(precision) << std::endl;
+}
@@ -0,0 +1,46 @@
+// Author: Michal K.
+
+#ifndef SOAK_MONITOR
+#define SOAK_MONITOR
+
+#include <SFML/System.hpp>
+#include <cstdint>
+#include "Profiler.h"
+#include "Simulation.h"
+
+// reports on a long unattended run, usually the AI gunner playing for hours
+// every interval of game ticks prints the games finished, heap allocations, resident memory and frame time percentiles
+// resident memory still growing after the first few reports, or p99 creeping up, is what a soak test is looking for
+class SoakMonitor
+{
+public:
+	// t_reportMinutes of ticks between reports, counted in ticks so a fast forwarded or headless run reports as often
+	SoakMonitor(float t_reportMinutes, sf::Time t_timePerTick);
+
+	// state of the tick just drawn or run, t_profiler holds the frames of the window or the ticks of a headless run
+	void sample(std::uint32_t t_tick, Simulation::m_gameState t_state, int t_score, int t_level, const Profiler & t_profiler);
+	void finish(); // growth of resident memory over the whole run, once the run ends
+
+private:
+	void report(std::uint32_t t_tick, const Profiler & t_profiler); // one line for the interval just finished
+
+	const float m_tickSeconds; // fixed step of the simulation
+	const std::uint32_t m_reportTicks; // ticks between reports
+	std::uint32_t m_nextReport; // tick the next report is due at
+	sf::Clock m_clock; // wall clock time since the run started
+	Simulation::m_gameState m_state = Simulation::mainMenu; // state of the last sample, game over is counted once
+
+	unsigned m_games = 0u; // games that reached game over
+	unsigned m_intervalGames = 0u; // of those, ended since the last report
+	long long m_intervalScore = 0; // total score of the games ended since the last report
+	int m_bestScore = 0; // highest score of any game
+	int m_bestLevel = 1; // highest level of any game
+
+	std::size_t m_allocations; // process wide heap allocations at the last report
+	std::uint64_t m_allocatingFrames = 0u; // profiler's count at the last report
+	std::size_t m_firstResident = 0u; // bytes resident at the first report, once the game has warmed up
+	std::size_t m_peakResident = 0u; // most bytes resident at any report
+	unsigned m_reports = 0u; // reports printed
+};
+
+#endif // !SOAK_MONITOR
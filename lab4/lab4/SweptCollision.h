@@ -0,0 +1,76 @@
+// Author: Michal K.
+
+#ifndef SWEPT_COLLISION
+#define SWEPT_COLLISION
+
+#include <SFML/System.hpp>
+#include <cmath>
+#include "VectorFormulas.h"
+
+// continuous collision for a point moving along a straight step during one tick
+// time of impact is found analytically so nothing is missed however far the point moves per tick
+// times are fractions of the step, 0 is the start of the tick and 1 the end
+
+
+// first time a point moving from t_start by t_step is inside a circle whose radius grows from t_radius by t_growth
+// solves |start + step t - centre| = radius + growth t, true only if contact happens within the step
+template <typename T>
+inline bool sweptCircleHit(sf::Vector2<T> t_start, sf::Vector2<T> t_step, sf::Vector2<T> t_centre,
+	T t_radius, T t_growth, T & t_time) noexcept
+{
+	const sf::Vector2<T> offset = t_start - t_centre; // centre to point at start of tick
+	const T a = vectorDotProduct(t_step, t_step) - t_growth * t_growth; // quadratic a t2 + 2b t + c <= 0
+	const T b = vectorDotProduct(offset, t_step) - t_radius * t_growth;
+	const T c = vectorDotProduct(offset, offset) - t_radius * t_radius;
+
+	if (c <= T(0)) // inside at start of tick
+	{
+		t_time = T(0);
+		return true;
+	}
+
+	if (a == T(0)) // point and circle edge close in at a constant rate
+	{
+		t_time = b < T(0) ? -c / (T(2) * b) : T(2);
+		return t_time <= T(1);
+	}
+
+	const T discriminant = b * b - a * c; // never negative when the circle grows faster than the point moves
+	if (discriminant < T(0)) // point passes outside the circle
+	{
+		return false;
+	}
+
+	// earliest contact after the start for either sign of a, both roots are behind the start if it is negative
+	t_time = (-b - std::sqrt(discriminant)) / a;
+	return t_time >= T(0) && t_time <= T(1);
+}
+
+// time a point moving from t_start by t_step crosses the segment t_lineStart to t_lineEnd
+// both parameters come from cross products, parallel movement never crosses
+template <typename T>
+inline bool sweptSegmentCross(sf::Vector2<T> t_start, sf::Vector2<T> t_step, sf::Vector2<T> t_lineStart,
+	sf::Vector2<T> t_lineEnd, T & t_time) noexcept
+{
+	const sf::Vector2<T> line = t_lineEnd - t_lineStart; // segment being crossed
+	const T denominator = vectorCrossProduct(t_step, line); // zero when moving along the segment
+
+	if (denominator == T(0))
+	{
+		return false;
+	}
+
+	const sf::Vector2<T> toLine = t_lineStart - t_start; // point to start of segment
+	const T time = vectorCrossProduct(toLine, line) / denominator; // fraction of the step
+	const T along = vectorCrossProduct(toLine, t_step) / denominator; // fraction of the segment
+
+	if (time < T(0) || time > T(1) || along < T(0) || along > T(1))
+	{
+		return false;
+	}
+
+	t_time = time;
+	return true;
+}
+
+#endif // !SWEPT_COLLISION
@@ -0,0 +1,239 @@
+// Author: Michal K.
+
+#include "Systems.h"
+#include <algorithm>
+#include <cmath>
+#include "SweptCollision.h"
+
+
+/// explosion radius is enlarged gradually
+/// runs before laserFlightSystem() so a laser that explodes this tick only grows for the part of the tick left
+/// an explosion reaching its max radius this tick is left for the collision test, finishedExplosionSystem() destroys it after
+void explosionSystem(World & t_world, float t_seconds)
+{
+	ComponentPool<Collider> & colliders = t_world.colliders();
+
+	for (std::size_t i = 0u; i < colliders.size(); i++)
+	{
+		Collider & collider = colliders[i];
+
+		if (collider.layer == Collider::explosion)
+		{
+			collider.radius += World::EXPLOSION_GROWTH * t_seconds; // radius enlarged
+			collider.bornAt = 0.0f; // alive for the whole of this tick
+		}
+	}
+}
+
+
+/// laser's journey to its stop height is animated
+/// if reached, explosion is triggered where the tip crossed it and grows for the rest of the tick,
+/// so where a laser explodes does not depend on the tick rate
+void laserFlightSystem(World & t_world, float t_seconds)
+{
+	ComponentPool<Lifetime> & lifetimes = t_world.lifetimes();
+
+	for (std::size_t i = 0u; i < lifetimes.size(); i++)
+	{
+		Lifetime & lifetime = lifetimes[i];
+
+		if (lifetime.stage != Lifetime::flight)
+		{
+			continue;
+		}
+
+		const Entity laser = lifetimes.entity(i);
+		Transform & transform = t_world.transforms().get(laser);
+		const sf::Vector2f step = t_world.velocities().get(laser).perSecond * t_seconds; // movement this tick
+		float radius = -1.0f; // radius of the explosion if the laser stops this tick
+		float fraction = 0.0f; // part of the tick spent flying, the explosion exists for the rest
+
+		if (transform.tipPoint.y <= lifetime.stopHeight) // already there, clicked below the base
+		{
+			radius = 0.0f;
+		}
+
+		else if (transform.tipPoint.y + step.y <= lifetime.stopHeight) // gets there during this tick
+		{
+			fraction = (lifetime.stopHeight - transform.tipPoint.y) / step.y;
+
+			transform.tipPoint += step * fraction;
+			radius = World::EXPLOSION_GROWTH * t_seconds * (1.0f - fraction); // grows for rest of tick
+		}
+
+		else
+		{
+			transform.tipPoint += step; // tip updated with velocity
+		}
+
+		if (radius >= 0.0f) // explosion is triggered, it stays where the laser stopped
+		{
+			lifetime.stage = Lifetime::explosion;
+			t_world.velocities().remove(laser);
+			t_world.colliders().add(laser, Collider{ Collider::explosion, radius, fraction });
+			t_world.renderables().get(laser).shape = Renderable::ring;
+		}
+	}
+}
+
+
+/// moves every tip by its velocity for t_seconds
+/// lasers in flight are left to laserFlightSystem(), they stop where their lifetime says
+void movementSystem(World & t_world, float t_seconds)
+{
+	const ComponentPool<Velocity> & velocities = t_world.velocities();
+	const ComponentPool<Lifetime> & lifetimes = t_world.lifetimes();
+	ComponentPool<Transform> & transforms = t_world.transforms();
+
+	for (std::size_t i = 0u; i < velocities.size(); i++)
+	{
+		const Entity entity = velocities.entity(i);
+
+		if (!lifetimes.has(entity))
+		{
+			transforms.get(entity).tipPoint += velocities[i].perSecond * t_seconds;
+		}
+	}
+}
+
+
+/// default constructor
+/// <param name="t_width">playfield width</param>
+/// <param name="t_height">playfield height</param>
+/// <param name="t_groundTop">y coordinate of top of the ground</param>
+CollisionSystem::CollisionSystem(float t_width, float t_height, float t_groundTop) :
+	m_width{ t_width },
+	m_groundTop{ t_groundTop },
+	m_grid{ t_width, t_height, 64.0f }
+{
+}
+
+
+/// checks for collisions of every asteroid over the whole tick, before asteroids are moved
+/// an asteroid only reaches the ground if it crosses it before any explosion touches it
+/// <param name="t_arena">tick's arena, the packed asteroid arrays are only needed until this returns</param>
+CollisionSystem::Result CollisionSystem::update(World & t_world, float t_seconds, FrameArena & t_arena)
+{
+	const ComponentPool<Collider> & colliders = t_world.colliders();
+	const float noHit = 2.0f; // hit time of an asteroid no explosion touches this tick
+	float longestStep = 0.0f; // squared, furthest any asteroid moves this tick
+	Result result;
+
+	// asteroids packed next to each other for the grid and the swept tests, sized once so the arena is not wasted
+	FrameVector<Entity> asteroids{ t_arena }; // every asteroid, in the order of the arrays below
+	FrameVector<sf::Vector2f> tipPoints{ t_arena }; // tip of each asteroid
+	FrameVector<sf::Vector2f> steps{ t_arena }; // movement of each asteroid this tick
+	asteroids.reserve(t_world.asteroidCount());
+	tipPoints.reserve(t_world.asteroidCount());
+	steps.reserve(t_world.asteroidCount());
+
+	for (std::size_t i = 0u; i < colliders.size(); i++)
+	{
+		if (colliders[i].layer == Collider::asteroid)
+		{
+			const Entity asteroid = colliders.entity(i);
+			const sf::Vector2f step = t_world.velocities().get(asteroid).perSecond * t_seconds; // movement this tick
+
+			asteroids.push_back(asteroid);
+			tipPoints.push_back(t_world.transforms().get(asteroid).tipPoint);
+			steps.push_back(step);
+			longestStep = std::max(longestStep, step.x * step.x + step.y * step.y);
+		}
+	}
+
+	const float reach = std::sqrt(longestStep); // furthest any asteroid moves this tick
+	FrameVector<float> hitTimes(asteroids.size(), noHit, t_arena); // earliest explosion contact of each asteroid as a fraction of the tick
+	m_grid.build(tipPoints.data(), tipPoints.size()); // broad phase, bucket every asteroid tip
+
+	for (std::size_t j = 0u; j < colliders.size(); j++)
+	{
+		const Collider & explosion = colliders[j];
+
+		if (explosion.layer != Collider::explosion) // only an explosion can shoot down asteroids
+		{
+			continue;
+		}
+
+		const sf::Vector2f centre = t_world.transforms().get(colliders.entity(j)).tipPoint; // where the laser stopped
+
+		// explosion grew to its current radius during the part of this tick it existed in
+		// one a laser made this tick only exists from when the laser stopped, it cannot hit anything before then
+		const float span = 1.0f - explosion.bornAt; // part of the tick the explosion existed in
+		const float growth = std::min(explosion.radius, World::EXPLOSION_GROWTH * t_seconds * span);
+		const float radiusBefore = explosion.radius - growth; // radius at start of tick, or when it appeared
+
+		// an explosion that reached its max radius this tick is gone from then on, only the part of the tick before counts
+		const float end = explosion.radius > World::MAX_EXPLOSION_RADIUS && growth > 0.0f
+			? explosion.bornAt + span * (World::MAX_EXPLOSION_RADIUS - radiusBefore) / growth : 1.0f;
+
+		// broad phase, any asteroid that can reach the explosion this tick starts within reach of it
+		m_hits.clear();
+		m_grid.queryCircle(centre, explosion.radius + reach, m_hits);
+
+		for (std::size_t hit : m_hits) // collision <asteroid path - growing explosion>
+		{
+			float hitTime = noHit; // fraction of the explosion's part of the tick the asteroid touches it
+
+			// swept from where the asteroid is when the explosion appears, times are then moved back onto the whole tick
+			if (sweptCircleHit(tipPoints[hit] + steps[hit] * explosion.bornAt, steps[hit] * span, centre, radiusBefore, growth, hitTime))
+			{
+				hitTime = explosion.bornAt + span * hitTime;
+
+				if (hitTime <= end && hitTime < hitTimes[hit])
+				{
+					hitTimes[hit] = hitTime;
+				}
+			}
+		}
+	}
+
+	const sf::Vector2f groundLeft{ 0.0f, m_groundTop }; // left end of ground surface
+	const sf::Vector2f groundRight{ m_width, m_groundTop }; // right end of ground surface
+
+	for (std::size_t i = 0u; i < asteroids.size(); i++)
+	{
+		float groundTime = noHit; // fraction of tick the asteroid reaches the ground
+
+		// collision <asteroid path - ground>, only if no explosion got to it first
+		if (sweptSegmentCross(tipPoints[i], steps[i], groundLeft, groundRight, groundTime)
+			&& groundTime < hitTimes[i])
+		{
+			for (Entity asteroid : asteroids) // wave is over
+			{
+				t_world.destroy(asteroid);
+			}
+
+			result.groundReached = true;
+			result.lastTime = groundTime;
+			return result;
+		}
+	}
+
+	for (std::size_t i = 0u; i < asteroids.size(); i++)
+	{
+		if (hitTimes[i] <= 1.0f) // asteroid shot down, even if by two explosions
+		{
+			t_world.destroy(asteroids[i]);
+			result.shotDown++;
+			result.lastTime = std::max(result.lastTime, hitTimes[i]);
+		}
+	}
+
+	return result;
+}
+
+
+/// explosions that reached their max radius this tick are destroyed, once the collision test has had the whole of their growth
+void finishedExplosionSystem(World & t_world)
+{
+	ComponentPool<Collider> & colliders = t_world.colliders();
+
+	// walked backwards, a destroyed explosion's place is taken by one already checked
+	for (std::size_t i = colliders.size(); i-- > 0u; )
+	{
+		if (colliders[i].layer == Collider::explosion && colliders[i].radius >= World::MAX_EXPLOSION_RADIUS)
+		{
+			t_world.destroy(colliders.entity(i));
+		}
+	}
+}
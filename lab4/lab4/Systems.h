@@ -0,0 +1,50 @@
+// Author: Michal K.
+
+#ifndef SYSTEMS
+#define SYSTEMS
+
+#include <SFML/System.hpp>
+#include <vector>
+#include "World.h"
+#include "CollisionGrid.h"
+#include "FrameArena.h"
+
+// systems of the game world, Simulation::update() runs them every tick in the order they are declared here
+// each one walks the packed pool of the component it is about and looks up the few others it needs
+
+void explosionSystem(World & t_world, float t_seconds); // explosions grow, finished ones stay until the end of the tick
+void laserFlightSystem(World & t_world, float t_seconds); // lasers fly to their stop height and explode there
+void movementSystem(World & t_world, float t_seconds); // everything else with a velocity moves in a straight line
+
+// explosion vs asteroid and asteroid vs ground over a whole tick, run before movementSystem() moves the asteroids
+// each asteroid tip sweeps the step it is about to take while each explosion grows from last tick's radius,
+// or from nothing from the moment in the tick its laser stopped
+// asteroid tips are bucketed into a grid so each explosion only tests asteroids close to it
+// asteroids are packed for the tests into arrays from the tick's arena, only the grid keeps memory between ticks
+class CollisionSystem
+{
+public:
+	struct Result
+	{
+		std::size_t shotDown = 0u; // asteroids an explosion touched, already destroyed
+		bool groundReached = false; // an asteroid crossed the ground before any explosion touched it
+		float lastTime = 0.0f; // fraction of the tick the last of those collisions happened at
+	};
+
+	CollisionSystem(float t_width, float t_height, float t_groundTop);
+
+	// shot down asteroids are destroyed, every asteroid is if one reached the ground
+	Result update(World & t_world, float t_seconds, FrameArena & t_arena);
+
+private:
+	const float m_width; // playfield width, the ground spans all of it
+	const float m_groundTop; // y coordinate of top of the ground
+
+	// cells are larger than the biggest explosion so an explosion overlaps at most four cells
+	CollisionGrid m_grid; // broad phase for explosion vs asteroid collisions
+	std::vector<std::size_t> m_hits; // asteroids inside the explosion being checked, reused for every explosion
+};
+
+void finishedExplosionSystem(World & t_world); // explosions that reached their max radius are destroyed, after the collisions
+
+#endif // !SYSTEMS
@@ -0,0 +1,133 @@
+// Author: Michal K.
+
+#include "ThreadPool.h"
+
+
+/// starts the workers
+/// <param name="t_threads">number of workers, zero uses one per core</param>
+ThreadPool::ThreadPool(unsigned t_threads)
+{
+	const unsigned cores = std::thread::hardware_concurrency(); // zero if unknown
+	const unsigned count = t_threads > 0u ? t_threads : (cores > 0u ? cores : 1u); // workers to start
+
+	for (unsigned i = 0u; i < count; i++)
+	{
+		m_workers.push_back(std::unique_ptr<Worker>{ new Worker });
+	}
+
+	for (unsigned i = 0u; i < count; i++)
+	{
+		m_threads.emplace_back(&ThreadPool::work, this, i);
+	}
+}
+
+
+/// finishes queued tasks, then stops the workers
+ThreadPool::~ThreadPool()
+{
+	wait();
+
+	{
+		std::lock_guard<std::mutex> lock{ m_sleepMutex };
+		m_stop = true;
+	}
+	m_taskAdded.notify_all();
+
+	for (std::thread & thread : m_threads)
+	{
+		thread.join();
+	}
+}
+
+
+/// queues a task on the next worker in turn, an idle worker wakes up for it
+/// the task is counted before it is pushed, a worker taking it at once would otherwise wrap m_queued below zero
+void ThreadPool::submit(std::function<void()> t_task)
+{
+	Worker & worker = *m_workers[m_nextWorker++ % m_workers.size()];
+
+	m_unfinished++;
+	{
+		std::lock_guard<std::mutex> lock{ m_sleepMutex }; // a worker about to sleep sees m_queued change
+		m_queued++;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock{ worker.mutex };
+		worker.tasks.push_back(std::move(t_task));
+	}
+	m_taskAdded.notify_one();
+}
+
+
+/// returns once every submitted task has finished
+void ThreadPool::wait()
+{
+	std::unique_lock<std::mutex> lock{ m_sleepMutex };
+	m_allFinished.wait(lock, [this] { return m_unfinished == 0u; });
+}
+
+
+/// runs tasks until stopped, sleeps while every queue is empty
+void ThreadPool::work(unsigned t_index)
+{
+	std::function<void()> task; // task being run
+
+	while (true)
+	{
+		if (takeTask(t_index, task))
+		{
+			task();
+			task = nullptr; // release anything the task captured before sleeping
+
+			if (--m_unfinished == 0u)
+			{
+				std::lock_guard<std::mutex> lock{ m_sleepMutex };
+				m_allFinished.notify_all();
+			}
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock{ m_sleepMutex };
+		m_taskAdded.wait(lock, [this] { return m_stop || m_queued > 0u; });
+
+		if (m_stop && m_queued == 0u)
+		{
+			return;
+		}
+	}
+}
+
+
+/// newest task of the worker's own queue, else the oldest task of the first other queue that has one
+bool ThreadPool::takeTask(unsigned t_index, std::function<void()> & t_task)
+{
+	{
+		Worker & own = *m_workers[t_index];
+		std::lock_guard<std::mutex> lock{ own.mutex };
+
+		if (!own.tasks.empty())
+		{
+			t_task = std::move(own.tasks.back());
+			own.tasks.pop_back();
+			m_queued--;
+			return true;
+		}
+	}
+
+	for (std::size_t offset = 1u; offset < m_workers.size(); offset++)
+	{
+		Worker & victim = *m_workers[(t_index + offset) % m_workers.size()];
+		std::lock_guard<std::mutex> lock{ victim.mutex };
+
+		if (!victim.tasks.empty())
+		{
+			t_task = std::move(victim.tasks.front());
+			victim.tasks.pop_front();
+			m_queued--;
+			return true;
+		}
+	}
+
+	return false;
+}
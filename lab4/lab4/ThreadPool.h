@@ -0,0 +1,51 @@
+// Author: Michal K.
+
+#ifndef THREAD_POOL
+#define THREAD_POOL
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// fixed set of worker threads, each with its own task queue
+// a worker takes its newest task first and steals the oldest task of another worker once its own queue is empty
+// so uneven tasks, like games that last very different times, still keep every core busy
+class ThreadPool
+{
+public:
+	explicit ThreadPool(unsigned t_threads); // zero uses one thread per core
+	~ThreadPool(); // finishes queued tasks, then stops the workers
+
+	void submit(std::function<void()> t_task); // queued on the workers in turn
+	void wait(); // returns once every submitted task has finished
+
+	unsigned size() const { return static_cast<unsigned>(m_threads.size()); } // number of workers
+
+private:
+	struct Worker
+	{
+		std::mutex mutex; // guards tasks
+		std::deque<std::function<void()>> tasks; // owner pops the back, thieves the front
+	};
+
+	void work(unsigned t_index); // worker thread body
+	bool takeTask(unsigned t_index, std::function<void()> & t_task); // own task first, else steal one
+
+	std::vector<std::unique_ptr<Worker>> m_workers; // one queue per thread
+	std::vector<std::thread> m_threads; // workers
+	std::atomic<unsigned> m_nextWorker{ 0u }; // queue the next submitted task goes to
+	std::atomic<std::size_t> m_queued{ 0u }; // tasks waiting in any queue, counted just before they are pushed
+	std::atomic<std::size_t> m_unfinished{ 0u }; // tasks submitted but not finished
+	std::atomic<bool> m_stop{ false }; // workers exit once queues are empty
+
+	std::mutex m_sleepMutex; // used only to sleep and wake
+	std::condition_variable m_taskAdded; // wakes idle workers
+	std::condition_variable m_allFinished; // wakes wait()
+};
+
+#endif // !THREAD_POOL
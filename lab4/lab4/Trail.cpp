@@ -0,0 +1,18 @@
+// Author: Michal K.
+
+#include "Trail.h"
+
+/// writes one projectile's trail as a single start to tip line into slot t_index of a sf::Lines array
+/// each slot is two vertices, start and tip, overwritten every tick instead of appended
+void setTrail(sf::VertexArray & t_trail, std::size_t t_index, sf::Vector2f t_start, sf::Vector2f t_tip)
+{
+	const std::size_t firstVertex = t_index * 2u; // every line takes two vertices
+
+	if (t_trail.getVertexCount() < firstVertex + 2u) // slot not used yet
+	{
+		t_trail.resize(firstVertex + 2u); // make room for slot, capacity is kept after clear()
+	}
+
+	t_trail[firstVertex].position = t_start; // start point vertex
+	t_trail[firstVertex + 1u].position = t_tip; // tip vertex
+}
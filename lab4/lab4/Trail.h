@@ -0,0 +1,12 @@
+// Author: Michal K.
+
+#ifndef TRAIL
+#define TRAIL
+
+#include <SFML/Graphics.hpp>
+
+// writes one projectile's trail as a single start to tip line into slot t_index of a sf::Lines array
+// the array only grows when a new slot is used, so memory and draw cost stay constant during flight
+void setTrail(sf::VertexArray & t_trail, std::size_t t_index, sf::Vector2f t_start, sf::Vector2f t_tip);
+
+#endif // !TRAIL
@@ -0,0 +1,409 @@
+// Author: Michal K.
+
+#include "VectorBatch.h"
+#include <cmath>
+
+#if defined(_M_X64) || defined(__x86_64__) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define VECTOR_BATCH_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define VECTOR_BATCH_AVX_TARGET // msvc compiles avx intrinsics without extra flags
+#else
+#define VECTOR_BATCH_AVX_TARGET __attribute__((target("avx"))) // only these functions use avx
+#endif
+#endif
+
+
+// scalar kernels, used for the remainder of every simd kernel and when no simd is available
+
+static void lengthScalar(const sf::Vector2f * t_vectors, float * t_lengths, std::size_t t_count)
+{
+	for (std::size_t i = 0u; i < t_count; i++)
+	{
+		t_lengths[i] = std::sqrt(t_vectors[i].x * t_vectors[i].x + t_vectors[i].y * t_vectors[i].y);
+	}
+}
+
+static void unitVectorScalar(const sf::Vector2f * t_vectors, sf::Vector2f * t_unitVectors, std::size_t t_count)
+{
+	for (std::size_t i = 0u; i < t_count; i++)
+	{
+		const sf::Vector2f vector = t_vectors[i]; // copied first, output may be the input
+		const float length = std::sqrt(vector.x * vector.x + vector.y * vector.y);
+		t_unitVectors[i] = length != 0.0f ? vector / length : sf::Vector2f{ 0.0f, 0.0f };
+	}
+}
+
+static void dotProductScalar(const sf::Vector2f * t_vectorsA, const sf::Vector2f * t_vectorsB, float * t_dotProducts, std::size_t t_count)
+{
+	for (std::size_t i = 0u; i < t_count; i++)
+	{
+		t_dotProducts[i] = t_vectorsA[i].x * t_vectorsB[i].x + t_vectorsA[i].y * t_vectorsB[i].y;
+	}
+}
+
+static void rotateByScalar(const sf::Vector2f * t_vectors, float t_cos, float t_sin, sf::Vector2f * t_rotated, std::size_t t_count)
+{
+	for (std::size_t i = 0u; i < t_count; i++)
+	{
+		const sf::Vector2f vector = t_vectors[i]; // copied first, output may be the input
+		t_rotated[i] = sf::Vector2f{ t_cos * vector.x - t_sin * vector.y, t_sin * vector.x + t_cos * vector.y };
+	}
+}
+
+static void distanceSquaredScalar(const sf::Vector2f * t_points, sf::Vector2f t_point, float * t_distancesSquared, std::size_t t_count)
+{
+	for (std::size_t i = 0u; i < t_count; i++)
+	{
+		const float x = t_points[i].x - t_point.x;
+		const float y = t_points[i].y - t_point.y;
+		t_distancesSquared[i] = x * x + y * y;
+	}
+}
+
+
+#ifdef VECTOR_BATCH_X86
+
+// sse kernels, four vectors per step
+// two loads hold x0 y0 x1 y1 | x2 y2 x3 y3, shuffles split them into x0 x1 x2 x3 and y0 y1 y2 y3
+
+static void lengthSse(const sf::Vector2f * t_vectors, float * t_lengths, std::size_t t_count)
+{
+	const float * in = &t_vectors[0].x;
+	std::size_t i = 0u;
+
+	for (; i + 4u <= t_count; i += 4u)
+	{
+		const __m128 a = _mm_loadu_ps(in + i * 2u);
+		const __m128 b = _mm_loadu_ps(in + i * 2u + 4u);
+		const __m128 x = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+		const __m128 y = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+		_mm_storeu_ps(t_lengths + i, _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y))));
+	}
+
+	lengthScalar(t_vectors + i, t_lengths + i, t_count - i);
+}
+
+static void unitVectorSse(const sf::Vector2f * t_vectors, sf::Vector2f * t_unitVectors, std::size_t t_count)
+{
+	const float * in = &t_vectors[0].x;
+	float * out = &t_unitVectors[0].x;
+	std::size_t i = 0u;
+
+	for (; i + 4u <= t_count; i += 4u)
+	{
+		const __m128 a = _mm_loadu_ps(in + i * 2u);
+		const __m128 b = _mm_loadu_ps(in + i * 2u + 4u);
+		const __m128 x = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+		const __m128 y = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+		const __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)));
+		const __m128 nonZero = _mm_cmpneq_ps(length, _mm_setzero_ps()); // zero vectors stay zero
+		const __m128 unitX = _mm_and_ps(_mm_div_ps(x, length), nonZero);
+		const __m128 unitY = _mm_and_ps(_mm_div_ps(y, length), nonZero);
+		_mm_storeu_ps(out + i * 2u, _mm_unpacklo_ps(unitX, unitY));
+		_mm_storeu_ps(out + i * 2u + 4u, _mm_unpackhi_ps(unitX, unitY));
+	}
+
+	unitVectorScalar(t_vectors + i, t_unitVectors + i, t_count - i);
+}
+
+static void dotProductSse(const sf::Vector2f * t_vectorsA, const sf::Vector2f * t_vectorsB, float * t_dotProducts, std::size_t t_count)
+{
+	const float * inA = &t_vectorsA[0].x;
+	const float * inB = &t_vectorsB[0].x;
+	std::size_t i = 0u;
+
+	for (; i + 4u <= t_count; i += 4u)
+	{
+		// products of matching components are still interleaved, shuffles add x and y parts together
+		const __m128 productA = _mm_mul_ps(_mm_loadu_ps(inA + i * 2u), _mm_loadu_ps(inB + i * 2u));
+		const __m128 productB = _mm_mul_ps(_mm_loadu_ps(inA + i * 2u + 4u), _mm_loadu_ps(inB + i * 2u + 4u));
+		const __m128 x = _mm_shuffle_ps(productA, productB, _MM_SHUFFLE(2, 0, 2, 0));
+		const __m128 y = _mm_shuffle_ps(productA, productB, _MM_SHUFFLE(3, 1, 3, 1));
+		_mm_storeu_ps(t_dotProducts + i, _mm_add_ps(x, y));
+	}
+
+	dotProductScalar(t_vectorsA + i, t_vectorsB + i, t_dotProducts + i, t_count - i);
+}
+
+static void rotateBySse(const sf::Vector2f * t_vectors, float t_cos, float t_sin, sf::Vector2f * t_rotated, std::size_t t_count)
+{
+	const float * in = &t_vectors[0].x;
+	float * out = &t_rotated[0].x;
+	const __m128 cosine = _mm_set1_ps(t_cos);
+	const __m128 sine = _mm_set1_ps(t_sin);
+	std::size_t i = 0u;
+
+	for (; i + 4u <= t_count; i += 4u)
+	{
+		const __m128 a = _mm_loadu_ps(in + i * 2u);
+		const __m128 b = _mm_loadu_ps(in + i * 2u + 4u);
+		const __m128 x = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+		const __m128 y = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+		const __m128 rotatedX = _mm_sub_ps(_mm_mul_ps(cosine, x), _mm_mul_ps(sine, y));
+		const __m128 rotatedY = _mm_add_ps(_mm_mul_ps(sine, x), _mm_mul_ps(cosine, y));
+		_mm_storeu_ps(out + i * 2u, _mm_unpacklo_ps(rotatedX, rotatedY));
+		_mm_storeu_ps(out + i * 2u + 4u, _mm_unpackhi_ps(rotatedX, rotatedY));
+	}
+
+	rotateByScalar(t_vectors + i, t_cos, t_sin, t_rotated + i, t_count - i);
+}
+
+static void distanceSquaredSse(const sf::Vector2f * t_points, sf::Vector2f t_point, float * t_distancesSquared, std::size_t t_count)
+{
+	const float * in = &t_points[0].x;
+	const __m128 point = _mm_setr_ps(t_point.x, t_point.y, t_point.x, t_point.y); // matches interleaved layout
+	std::size_t i = 0u;
+
+	for (; i + 4u <= t_count; i += 4u)
+	{
+		const __m128 a = _mm_sub_ps(_mm_loadu_ps(in + i * 2u), point);
+		const __m128 b = _mm_sub_ps(_mm_loadu_ps(in + i * 2u + 4u), point);
+		const __m128 squaredA = _mm_mul_ps(a, a);
+		const __m128 squaredB = _mm_mul_ps(b, b);
+		const __m128 x = _mm_shuffle_ps(squaredA, squaredB, _MM_SHUFFLE(2, 0, 2, 0));
+		const __m128 y = _mm_shuffle_ps(squaredA, squaredB, _MM_SHUFFLE(3, 1, 3, 1));
+		_mm_storeu_ps(t_distancesSquared + i, _mm_add_ps(x, y));
+	}
+
+	distanceSquaredScalar(t_points + i, t_point, t_distancesSquared + i, t_count - i);
+}
+
+
+// avx kernels, eight vectors per step
+// 128 bit halves are swapped first so the per lane shuffles give x0 .. x7 and y0 .. y7 in order
+
+VECTOR_BATCH_AVX_TARGET static void splitAvx(const float * t_in, __m256 & t_x, __m256 & t_y)
+{
+	const __m256 a = _mm256_loadu_ps(t_in); // v0 v1 | v2 v3
+	const __m256 b = _mm256_loadu_ps(t_in + 8); // v4 v5 | v6 v7
+	const __m256 low = _mm256_permute2f128_ps(a, b, 0x20); // v0 v1 | v4 v5
+	const __m256 high = _mm256_permute2f128_ps(a, b, 0x31); // v2 v3 | v6 v7
+	t_x = _mm256_shuffle_ps(low, high, _MM_SHUFFLE(2, 0, 2, 0));
+	t_y = _mm256_shuffle_ps(low, high, _MM_SHUFFLE(3, 1, 3, 1));
+}
+
+VECTOR_BATCH_AVX_TARGET static void joinAvx(__m256 t_x, __m256 t_y, float * t_out)
+{
+	const __m256 low = _mm256_unpacklo_ps(t_x, t_y); // v0 v1 | v4 v5
+	const __m256 high = _mm256_unpackhi_ps(t_x, t_y); // v2 v3 | v6 v7
+	_mm256_storeu_ps(t_out, _mm256_permute2f128_ps(low, high, 0x20));
+	_mm256_storeu_ps(t_out + 8, _mm256_permute2f128_ps(low, high, 0x31));
+}
+
+VECTOR_BATCH_AVX_TARGET static void lengthAvx(const sf::Vector2f * t_vectors, float * t_lengths, std::size_t t_count)
+{
+	const float * in = &t_vectors[0].x;
+	std::size_t i = 0u;
+
+	for (; i + 8u <= t_count; i += 8u)
+	{
+		__m256 x, y;
+		splitAvx(in + i * 2u, x, y);
+		_mm256_storeu_ps(t_lengths + i, _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(y, y))));
+	}
+
+	lengthSse(t_vectors + i, t_lengths + i, t_count - i);
+}
+
+VECTOR_BATCH_AVX_TARGET static void unitVectorAvx(const sf::Vector2f * t_vectors, sf::Vector2f * t_unitVectors, std::size_t t_count)
+{
+	const float * in = &t_vectors[0].x;
+	float * out = &t_unitVectors[0].x;
+	std::size_t i = 0u;
+
+	for (; i + 8u <= t_count; i += 8u)
+	{
+		__m256 x, y;
+		splitAvx(in + i * 2u, x, y);
+		const __m256 length = _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(y, y)));
+		const __m256 nonZero = _mm256_cmp_ps(length, _mm256_setzero_ps(), _CMP_NEQ_OQ); // zero vectors stay zero
+		joinAvx(_mm256_and_ps(_mm256_div_ps(x, length), nonZero), _mm256_and_ps(_mm256_div_ps(y, length), nonZero), out + i * 2u);
+	}
+
+	unitVectorSse(t_vectors + i, t_unitVectors + i, t_count - i);
+}
+
+VECTOR_BATCH_AVX_TARGET static void dotProductAvx(const sf::Vector2f * t_vectorsA, const sf::Vector2f * t_vectorsB, float * t_dotProducts, std::size_t t_count)
+{
+	const float * inA = &t_vectorsA[0].x;
+	const float * inB = &t_vectorsB[0].x;
+	std::size_t i = 0u;
+
+	for (; i + 8u <= t_count; i += 8u)
+	{
+		__m256 xA, yA, xB, yB;
+		splitAvx(inA + i * 2u, xA, yA);
+		splitAvx(inB + i * 2u, xB, yB);
+		_mm256_storeu_ps(t_dotProducts + i, _mm256_add_ps(_mm256_mul_ps(xA, xB), _mm256_mul_ps(yA, yB)));
+	}
+
+	dotProductSse(t_vectorsA + i, t_vectorsB + i, t_dotProducts + i, t_count - i);
+}
+
+VECTOR_BATCH_AVX_TARGET static void rotateByAvx(const sf::Vector2f * t_vectors, float t_cos, float t_sin, sf::Vector2f * t_rotated, std::size_t t_count)
+{
+	const float * in = &t_vectors[0].x;
+	float * out = &t_rotated[0].x;
+	const __m256 cosine = _mm256_set1_ps(t_cos);
+	const __m256 sine = _mm256_set1_ps(t_sin);
+	std::size_t i = 0u;
+
+	for (; i + 8u <= t_count; i += 8u)
+	{
+		__m256 x, y;
+		splitAvx(in + i * 2u, x, y);
+		const __m256 rotatedX = _mm256_sub_ps(_mm256_mul_ps(cosine, x), _mm256_mul_ps(sine, y));
+		const __m256 rotatedY = _mm256_add_ps(_mm256_mul_ps(sine, x), _mm256_mul_ps(cosine, y));
+		joinAvx(rotatedX, rotatedY, out + i * 2u);
+	}
+
+	rotateBySse(t_vectors + i, t_cos, t_sin, t_rotated + i, t_count - i);
+}
+
+VECTOR_BATCH_AVX_TARGET static void distanceSquaredAvx(const sf::Vector2f * t_points, sf::Vector2f t_point, float * t_distancesSquared, std::size_t t_count)
+{
+	const float * in = &t_points[0].x;
+	const __m256 pointX = _mm256_set1_ps(t_point.x);
+	const __m256 pointY = _mm256_set1_ps(t_point.y);
+	std::size_t i = 0u;
+
+	for (; i + 8u <= t_count; i += 8u)
+	{
+		__m256 x, y;
+		splitAvx(in + i * 2u, x, y);
+		x = _mm256_sub_ps(x, pointX);
+		y = _mm256_sub_ps(y, pointY);
+		_mm256_storeu_ps(t_distancesSquared + i, _mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(y, y)));
+	}
+
+	distanceSquaredSse(t_points + i, t_point, t_distancesSquared + i, t_count - i);
+}
+
+
+/// true if cpu and operating system both support avx
+static bool cpuSupportsAvx()
+{
+#ifdef _MSC_VER
+	int info[4]; // eax, ebx, ecx, edx
+	__cpuid(info, 1);
+	const bool osSavesAvx = (info[2] & (1 << 27)) != 0; // osxsave
+	const bool cpuHasAvx = (info[2] & (1 << 28)) != 0; // avx
+	return osSavesAvx && cpuHasAvx && (_xgetbv(0) & 0x6) == 0x6; // xmm and ymm state saved
+#else
+	return __builtin_cpu_supports("avx");
+#endif
+}
+
+#endif // VECTOR_BATCH_X86
+
+
+// kernels used by the batch functions
+struct VectorBatchKernels
+{
+	VectorBatchPath path;
+	void(*length)(const sf::Vector2f *, float *, std::size_t);
+	void(*unitVector)(const sf::Vector2f *, sf::Vector2f *, std::size_t);
+	void(*dotProduct)(const sf::Vector2f *, const sf::Vector2f *, float *, std::size_t);
+	void(*rotateBy)(const sf::Vector2f *, float, float, sf::Vector2f *, std::size_t);
+	void(*distanceSquared)(const sf::Vector2f *, sf::Vector2f, float *, std::size_t);
+};
+
+static const VectorBatchKernels s_scalarKernels{ VectorBatchPath::scalar, lengthScalar, unitVectorScalar, dotProductScalar, rotateByScalar, distanceSquaredScalar };
+#ifdef VECTOR_BATCH_X86
+static const VectorBatchKernels s_sseKernels{ VectorBatchPath::sse, lengthSse, unitVectorSse, dotProductSse, rotateBySse, distanceSquaredSse };
+static const VectorBatchKernels s_avxKernels{ VectorBatchPath::avx, lengthAvx, unitVectorAvx, dotProductAvx, rotateByAvx, distanceSquaredAvx };
+#endif
+
+
+/// fastest kernels the cpu supports, checked once
+static const VectorBatchKernels * bestKernels()
+{
+#ifdef VECTOR_BATCH_X86
+	return cpuSupportsAvx() ? &s_avxKernels : &s_sseKernels; // sse2 is always there on x86-64
+#else
+	return &s_scalarKernels;
+#endif
+}
+
+static const VectorBatchKernels * s_kernels = bestKernels(); // kernels currently used
+
+
+/// lengths of every vector
+void vectorLengthBatch(const sf::Vector2f * t_vectors, float * t_lengths, std::size_t t_count)
+{
+	s_kernels->length(t_vectors, t_lengths, t_count);
+}
+
+/// unit vector of every vector, zero vectors stay zero
+void vectorUnitVectorBatch(const sf::Vector2f * t_vectors, sf::Vector2f * t_unitVectors, std::size_t t_count)
+{
+	s_kernels->unitVector(t_vectors, t_unitVectors, t_count);
+}
+
+/// dot product of every pair of vectors
+void vectorDotProductBatch(const sf::Vector2f * t_vectorsA, const sf::Vector2f * t_vectorsB, float * t_dotProducts, std::size_t t_count)
+{
+	s_kernels->dotProduct(t_vectorsA, t_vectorsB, t_dotProducts, t_count);
+}
+
+/// every vector rotated anti-clockwise by the same angle, cos and sin are only worked out once
+void vectorRotateByBatch(const sf::Vector2f * t_vectors, float t_angleRadians, sf::Vector2f * t_rotated, std::size_t t_count)
+{
+	s_kernels->rotateBy(t_vectors, std::cos(t_angleRadians), std::sin(t_angleRadians), t_rotated, t_count);
+}
+
+/// squared distance from every point to one point
+void vectorDistanceSquaredBatch(const sf::Vector2f * t_points, sf::Vector2f t_point, float * t_distancesSquared, std::size_t t_count)
+{
+	s_kernels->distanceSquared(t_points, t_point, t_distancesSquared, t_count);
+}
+
+
+/// kernels currently used
+VectorBatchPath vectorBatchPath()
+{
+	return s_kernels->path;
+}
+
+
+/// switch kernels, false if cpu does not support them
+bool setVectorBatchPath(VectorBatchPath t_path)
+{
+	switch (t_path)
+	{
+	case VectorBatchPath::scalar:
+		s_kernels = &s_scalarKernels;
+		return true;
+#ifdef VECTOR_BATCH_X86
+	case VectorBatchPath::sse:
+		s_kernels = &s_sseKernels;
+		return true;
+	case VectorBatchPath::avx:
+		if (cpuSupportsAvx())
+		{
+			s_kernels = &s_avxKernels;
+			return true;
+		}
+		return false;
+#endif
+	default:
+		return false;
+	}
+}
+
+
+/// name for printing
+const char * vectorBatchPathName(VectorBatchPath t_path)
+{
+	switch (t_path)
+	{
+	case VectorBatchPath::sse:
+		return "sse";
+	case VectorBatchPath::avx:
+		return "avx";
+	default:
+		return "scalar";
+	}
+}
@@ -0,0 +1,26 @@
+// Author: Michal K.
+
+#ifndef VECTOR_BATCH
+#define VECTOR_BATCH
+
+#include <SFML/System.hpp>
+#include <cstddef>
+
+// array at a time versions of VectorFormulas
+// each call works through t_count vectors with SSE or AVX kernels, picked once at runtime from what the cpu supports
+// output arrays may be the same as input arrays, results match the one vector at a time functions
+
+void vectorLengthBatch(const sf::Vector2f * t_vectors, float * t_lengths, std::size_t t_count); // root x2 + y2
+void vectorUnitVectorBatch(const sf::Vector2f * t_vectors, sf::Vector2f * t_unitVectors, std::size_t t_count); // length of ans is one
+void vectorDotProductBatch(const sf::Vector2f * t_vectorsA, const sf::Vector2f * t_vectorsB, float * t_dotProducts, std::size_t t_count); // Vx * Ux + Vy * Uy
+void vectorRotateByBatch(const sf::Vector2f * t_vectors, float t_angleRadians, sf::Vector2f * t_rotated, std::size_t t_count); // every vector by same angle
+void vectorDistanceSquaredBatch(const sf::Vector2f * t_points, sf::Vector2f t_point, float * t_distancesSquared, std::size_t t_count); // to one point
+
+
+enum class VectorBatchPath { scalar, sse, avx }; // kernels the batch functions can run on
+
+VectorBatchPath vectorBatchPath(); // kernels currently used
+bool setVectorBatchPath(VectorBatchPath t_path); // switch kernels, false if cpu does not support them
+const char * vectorBatchPathName(VectorBatchPath t_path); // name for printing
+
+#endif // !VECTOR_BATCH
@@ -3,25 +3,110 @@
 #ifndef VectorFormulas
 #define VectorFormulas
 
-#include <SFML/Graphics.hpp>
+#include <SFML/System.hpp>
+#include <cmath>
 
+// header only so every call can be inlined into the update loop
+// templated on the component type, works for sf::Vector2f and sf::Vector2<double>
+// sf::Vector2 has no constexpr constructors in SFML 2.5, so these are inline rather than constexpr
 
 
-float vectorLength(const sf::Vector2f t_vector);  // root x2 + y2
-float vectorLengthSquared(const sf::Vector2f t_vector); // x2 + y2
-sf::Vector2f vectorUnitVector(sf::Vector2f t_vector);// length of ans is one
-float vectorCrossProduct(sf::Vector2f t_vectorA, sf::Vector2f t_vectorB);  // Vx * Uy - Vy * Ux
-float vectorDotProduct(sf::Vector2f t_vectorA, sf::Vector2f t_vectorB);  // Vx * Uy + Vy * Ux
-float vectorAngleBetween(sf::Vector2f t_vectorA, sf::Vector2f t_vectorB); // result always 0>= && <=180
-sf::Vector2f vectorRotateBy(sf::Vector2f t_vector, float t_angleRadians); // anti-clockwise ({1,0},PI/2) = {0,1}
-sf::Vector2f vectorProjection(sf::Vector2f t_vector, sf::Vector2f t_onto);// ans parallel to second vector
-sf::Vector2f vectorRejection(sf::Vector2f t_vector, sf::Vector2f t_onto);// ans perpendicular to second vector
-float vectorScalarProjection(sf::Vector2f t_vector, sf::Vector2f t_onto);// scalar resolute
+const float PI = 3.14159265359f;
 
 
+// get length squared of a vector
+template <typename T>
+inline T vectorLengthSquared(const sf::Vector2<T> t_vector) noexcept // x2 + y2
+{
+	return (t_vector.x * t_vector.x) + (t_vector.y * t_vector.y);
+}
 
-const float PI = 3.14159265359f;
+// get length of vector using sqrt of the sum of the squares
+template <typename T>
+inline T vectorLength(const sf::Vector2<T> t_vector) noexcept // root x2 + y2
+{
+	return std::sqrt(vectorLengthSquared(t_vector));
+}
+
+// gets a vector with a magnitude of 1, zero vector stays zero
+template <typename T>
+inline sf::Vector2<T> vectorUnitVector(sf::Vector2<T> t_vector) noexcept // length of ans is one
+{
+	const T length = vectorLength(t_vector); // magnitude of A
+
+	return length != T(0) ? t_vector / length : sf::Vector2<T>{ T(0), T(0) };
+}
+
+// get area of parallelogram using vectors
+template <typename T>
+inline T vectorCrossProduct(sf::Vector2<T> t_vectorA, sf::Vector2<T> t_vectorB) noexcept // Vx * Uy - Vy * Ux
+{
+	return (t_vectorA.x * t_vectorB.y) - (t_vectorA.y * t_vectorB.x);
+}
+
+// get scalar value of vector A and B
+template <typename T>
+inline T vectorDotProduct(sf::Vector2<T> t_vectorA, sf::Vector2<T> t_vectorB) noexcept // Vx * Ux + Vy * Uy
+{
+	return (t_vectorA.x * t_vectorB.x) + (t_vectorA.y * t_vectorB.y);
+}
+
+// get angle in degrees in between two vectors, zero if either vector is zero
+template <typename T>
+inline T vectorAngleBetween(sf::Vector2<T> t_vectorA, sf::Vector2<T> t_vectorB) noexcept // result always 0>= && <=180
+{
+	const T lengths = vectorLength(t_vectorA) * vectorLength(t_vectorB); // product of magnitudes
+
+	if (lengths == T(0)) // a zero vector has no direction
+	{
+		return T(0);
+	}
+
+	const T cosine = vectorDotProduct(t_vectorA, t_vectorB) / lengths;
+	const T clamped = cosine > T(1) ? T(1) : (cosine < T(-1) ? T(-1) : cosine); // rounding can leave acos range
+
+	return std::acos(clamped) * (T(180) / T(3.14159265358979323846)); // cos inverse, radians to degrees
+}
+
+// get a vector rotated anti-clockwise by an angle
+template <typename T>
+inline sf::Vector2<T> vectorRotateBy(sf::Vector2<T> t_vector, T t_angleRadians) noexcept // anti-clockwise ({1,0},PI/2) = {0,1}
+{
+	const T cosine = std::cos(t_angleRadians);
+	const T sine = std::sin(t_angleRadians);
+
+	return sf::Vector2<T>{ (cosine * t_vector.x) - (sine * t_vector.y), (sine * t_vector.x) + (cosine * t_vector.y) };
+}
+
+// get the part of a vector parallel to a second vector, (A.B / |B|2) B, zero if B is zero
+template <typename T>
+inline sf::Vector2<T> vectorProjection(sf::Vector2<T> t_vector, sf::Vector2<T> t_onto) noexcept // ans parallel to second vector
+{
+	const T magnitudeSquared = vectorLengthSquared(t_onto); // magnitude squared of B
+
+	if (magnitudeSquared == T(0)) // nothing to project onto
+	{
+		return sf::Vector2<T>{ T(0), T(0) };
+	}
+
+	return t_onto * (vectorDotProduct(t_vector, t_onto) / magnitudeSquared);
+}
+
+// get the part of a vector perpendicular to a second vector, A - projection
+template <typename T>
+inline sf::Vector2<T> vectorRejection(sf::Vector2<T> t_vector, sf::Vector2<T> t_onto) noexcept // ans perpendicular to second vector
+{
+	return t_vector - vectorProjection(t_vector, t_onto);
+}
+
+// gets a scalar value based on the projection formula, A.B / |B|, zero if B is zero
+template <typename T>
+inline T vectorScalarProjection(sf::Vector2<T> t_vector, sf::Vector2<T> t_onto) noexcept // scalar resolute
+{
+	const T magnitude = vectorLength(t_onto); // magnitude of B
 
+	return magnitude != T(0) ? vectorDotProduct(t_vector, t_onto) / magnitude : T(0);
+}
 
 
-#endif  // VectorFormulas
\ No newline at end of file
+#endif  // VectorFormulas
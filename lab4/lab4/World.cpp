@@ -0,0 +1,117 @@
+// Author: Michal K.
+
+#include "World.h"
+#include <algorithm>
+#include "VectorBatch.h"
+#include "VectorFormulas.h"
+
+
+/// room for every laser up front, firing never allocates
+World::World()
+{
+	m_transforms.reserve(MAX_LASERS);
+	m_velocities.reserve(MAX_LASERS);
+	m_lifetimes.reserve(MAX_LASERS);
+	m_colliders.reserve(MAX_LASERS);
+	m_renderables.reserve(MAX_LASERS);
+	m_freeIds.reserve(MAX_LASERS);
+}
+
+
+/// new entity without components, the most recently freed id is reused first
+Entity World::create()
+{
+	if (!m_freeIds.empty())
+	{
+		const Entity entity = m_freeIds.back();
+		m_freeIds.pop_back();
+		return entity;
+	}
+
+	return m_nextId++;
+}
+
+
+/// removes the entity from every pool, its id is handed out again by create()
+void World::destroy(Entity t_entity)
+{
+	if (m_colliders.has(t_entity) && m_colliders.get(t_entity).layer == Collider::asteroid)
+	{
+		m_asteroidCount--;
+	}
+
+	m_transforms.remove(t_entity);
+	m_velocities.remove(t_entity);
+	m_lifetimes.remove(t_entity);
+	m_colliders.remove(t_entity);
+	m_renderables.remove(t_entity);
+	m_freeIds.push_back(t_entity);
+}
+
+
+/// destroys every entity, ids start from zero again
+void World::clear()
+{
+	m_transforms.clear();
+	m_velocities.clear();
+	m_lifetimes.clear();
+	m_colliders.clear();
+	m_renderables.clear();
+	m_freeIds.clear();
+	m_nextId = 0u;
+	m_asteroidCount = 0u;
+}
+
+
+/// an asteroid is a trail with a velocity and a point collider
+/// direction of every new asteroid is calculated in one batch
+void World::spawnAsteroids(std::size_t t_count, float t_speed, float t_width, float t_height, Random & t_random, FrameArena & t_arena)
+{
+	const int width = static_cast<int>(t_width); // playfield width for random numbers
+	FrameVector<sf::Vector2f> startPoints(t_count, sf::Vector2f{}, t_arena); // start point of each new asteroid
+	FrameVector<sf::Vector2f> directions(t_count, sf::Vector2f{}, t_arena); // direction of each new asteroid
+
+	for (std::size_t i = 0u; i < t_count; i++)
+	{
+		float randomStartPoint = t_random.nextInt(width) + 1.0f; // random number <0 - playfield width>
+		float randomEndPoint = t_random.nextInt(width) + 1.0f; // random number <0 - playfield width>
+
+		startPoints[i] = sf::Vector2f{ randomStartPoint, 0.0f }; // start point on top of playfield
+		directions[i] = sf::Vector2f{ randomEndPoint, t_height } - startPoints[i]; // end point(Q) - start point(P)
+	}
+
+	// direction of every new asteroid in one batch
+	vectorUnitVectorBatch(directions.data(), directions.data(), t_count);
+
+	for (std::size_t i = 0u; i < t_count; i++)
+	{
+		const Entity asteroid = create();
+
+		m_transforms.add(asteroid, Transform{ startPoints[i], startPoints[i] }); // tip starts at start point
+		m_velocities.add(asteroid, Velocity{ directions[i] * t_speed }); // speed of asteroid in its direction
+		m_colliders.add(asteroid, Collider{ Collider::asteroid, 0.0f });
+		m_renderables.add(asteroid, Renderable{ Renderable::trail });
+	}
+
+	m_asteroidCount += t_count;
+}
+
+
+/// a laser is a trail with a velocity and a lifetime, it turns into an explosion once it stops
+/// laser stops at mouse click location or max altitude based on power of power bar, whichever is lower
+Entity World::spawnLaser(sf::Vector2f t_startPoint, sf::Vector2f t_destination, float t_speed, float t_altitude)
+{
+	if (laserCount() == MAX_LASERS) // no laser free
+	{
+		return NO_ENTITY;
+	}
+
+	const Entity laser = create();
+
+	m_transforms.add(laser, Transform{ t_startPoint, t_startPoint }); // tip starts at the base
+	m_velocities.add(laser, Velocity{ vectorUnitVector(t_destination - t_startPoint) * t_speed }); // speed of laser in its direction
+	m_lifetimes.add(laser, Lifetime{ std::max(t_destination.y, t_altitude), Lifetime::flight });
+	m_renderables.add(laser, Renderable{ Renderable::trail });
+
+	return laser;
+}
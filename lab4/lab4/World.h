@@ -0,0 +1,62 @@
+// Author: Michal K.
+
+#ifndef WORLD
+#define WORLD
+
+#include <SFML/System.hpp>
+#include <vector>
+#include "ComponentPool.h"
+#include "Components.h"
+#include "Random.h"
+#include "FrameArena.h"
+
+// every entity of the game world and one packed pool per component type
+// systems in Systems.h work through the pools, Simulation runs them in a fixed order every tick
+// a new kind of entity is a new set of components made in a spawn function, not a new branch in every system
+class World
+{
+public:
+	static const std::size_t MAX_LASERS = 64u; // max lasers and explosions alive at once
+	static constexpr float MAX_EXPLOSION_RADIUS = 30.0f; // explosion ends once this radius is reached
+	static constexpr float EXPLOSION_GROWTH = 60.0f; // pixels of radius gained per second
+
+	World();
+
+	Entity create(); // new entity without components, ids of destroyed entities are reused
+	void destroy(Entity t_entity); // removes every component of the entity, its id is free again
+	void clear(); // destroys every entity, memory is kept for the next game
+
+	// launches t_count asteroids from random points on top of the playfield to random points on the bottom
+	// t_speed is in pixels per second, the spawn list is built in t_arena
+	void spawnAsteroids(std::size_t t_count, float t_speed, float t_width, float t_height, Random & t_random, FrameArena & t_arena);
+
+	// fires a laser from start point to destination at t_speed pixels per second, NO_ENTITY if MAX_LASERS are alive
+	Entity spawnLaser(sf::Vector2f t_startPoint, sf::Vector2f t_destination, float t_speed, float t_altitude);
+
+	std::size_t asteroidCount() const { return m_asteroidCount; } // asteroids in the air
+	std::size_t laserCount() const { return m_lifetimes.size(); } // lasers and explosions alive, only lasers have a lifetime
+
+	ComponentPool<Transform> & transforms() { return m_transforms; }
+	ComponentPool<Velocity> & velocities() { return m_velocities; }
+	ComponentPool<Lifetime> & lifetimes() { return m_lifetimes; }
+	ComponentPool<Collider> & colliders() { return m_colliders; }
+	ComponentPool<Renderable> & renderables() { return m_renderables; }
+	const ComponentPool<Transform> & transforms() const { return m_transforms; }
+	const ComponentPool<Velocity> & velocities() const { return m_velocities; }
+	const ComponentPool<Lifetime> & lifetimes() const { return m_lifetimes; }
+	const ComponentPool<Collider> & colliders() const { return m_colliders; }
+	const ComponentPool<Renderable> & renderables() const { return m_renderables; }
+
+private:
+	ComponentPool<Transform> m_transforms; // every projectile
+	ComponentPool<Velocity> m_velocities; // asteroids and lasers still flying
+	ComponentPool<Lifetime> m_lifetimes; // lasers, flying or exploding
+	ComponentPool<Collider> m_colliders; // asteroids and explosions
+	ComponentPool<Renderable> m_renderables; // everything drawn
+
+	std::vector<Entity> m_freeIds; // ids of destroyed entities, reused before new ones
+	Entity m_nextId = 0u; // lowest id never handed out
+	std::size_t m_asteroidCount = 0u; // entities with an asteroid collider
+};
+
+#endif // !WORLD
@@ -1,38 +1,85 @@
-/// <summary>
-/// Empty Project for SFML[2.5.0]
-/// 
-/// 
-/// Author: Michal Krzyzanowski
-/// @date May 2018
-/// </summary>
-
-#ifdef _DEBUG 
-#pragma comment(lib,"sfml-graphics-d.lib") 
-#pragma comment(lib,"sfml-audio-d.lib") 
-#pragma comment(lib,"sfml-system-d.lib") 
-#pragma comment(lib,"sfml-window-d.lib") 
-#pragma comment(lib,"sfml-network-d.lib") 
-#else 
-#pragma comment(lib,"sfml-graphics.lib") 
-#pragma comment(lib,"sfml-audio.lib") 
-#pragma comment(lib,"sfml-system.lib") 
-#pragma comment(lib,"sfml-window.lib") 
-#pragma comment(lib,"sfml-network.lib") 
-#endif 
-
-#include "game.h"
-
-
-
-/// <summary>
-/// main entry point
-/// </summary>
-/// <returns>zero</returns>
-int main()
-{
-	srand(static_cast<unsigned>(time(NULL))); // seed of rand() function, casted into an unsigned int
-
-	Game game;
-	game.run();
-	return 0;
-}
\ No newline at end of file
+/// <summary>
+/// Empty Project for SFML[2.5.0]
+/// 
+/// 
+/// Author: Michal Krzyzanowski
+/// @date May 2018
+/// </summary>
+
+// the Visual Studio project links SFML here, the CMake build links it with target_link_libraries
+#if defined(_MSC_VER) && !defined(LAB4_CMAKE_BUILD)
+#ifdef _DEBUG 
+#pragma comment(lib,"sfml-graphics-d.lib") 
+#pragma comment(lib,"sfml-audio-d.lib") 
+#pragma comment(lib,"sfml-system-d.lib") 
+#pragma comment(lib,"sfml-window-d.lib") 
+#pragma comment(lib,"sfml-network-d.lib") 
+#else 
+#pragma comment(lib,"sfml-graphics.lib") 
+#pragma comment(lib,"sfml-audio.lib") 
+#pragma comment(lib,"sfml-system.lib") 
+#pragma comment(lib,"sfml-window.lib") 
+#pragma comment(lib,"sfml-network.lib") 
+#endif 
+#endif
+
+#include "Game.h"
+#include "Options.h"
+#include "Benchmark.h"
+#include "Headless.h"
+#include "BatchRunner.h"
+#include "GoldenImages.h"
+#include "Settings.h"
+#include "Assets.h"
+#include "Profiler.h"
+#include <iostream>
+
+
+
+/// <summary>
+/// main entry point
+/// command line arguments are described by parseOptions()
+/// </summary>
+/// <returns>zero, one if a golden image check failed, GOLDEN_SKIPPED_EXIT if there were no golden images to check</returns>
+int main(int argc, char * argv[])
+{
+	StartupTimer startup; // time to the first frame shown, reported by the game
+
+	const Options options = parseOptions(argc, argv); // settings from command line
+
+	Settings settings; // window size and balance, shipped defaults unless the settings file changes them
+	const std::string configPath = options.configPath.empty() ? assetPath("settings.ini") : options.configPath; // file read
+	if (!loadSettings(configPath, settings))
+	{
+		std::cout << "problem loading settings " << configPath << ", using defaults" << std::endl;
+	}
+	startup.mark("settings");
+
+	if (options.benchmark)
+	{
+		runBenchmarks(options.benchmarkPath);
+		return 0;
+	}
+
+	if (!options.goldenPath.empty())
+	{
+		const GoldenResult golden = runGoldenImages(options, settings); // shipped settings.ini unless --config
+		return golden == goldenPassed ? 0 : (golden == goldenMissing ? GOLDEN_SKIPPED_EXIT : 1);
+	}
+
+	if (!options.batchPath.empty())
+	{
+		runBatch(options, settings);
+		return 0;
+	}
+
+	if (options.headlessTicks > 0u)
+	{
+		runHeadless(options, settings);
+		return 0;
+	}
+
+	Game game{ options, settings, startup };
+	game.run();
+	return 0;
+}
@@ -0,0 +1,44 @@
+// Author: Michal K.
+
+#ifndef CHECK
+#define CHECK
+
+#include <cmath>
+#include <iostream>
+
+// just enough of a test framework for ctest, every test executable is one main() of checks
+// a failed check prints where it is and carries on, main() returns testResult() so ctest sees any failure
+
+// number of failed checks so far
+inline int & checkFailures()
+{
+	static int failures = 0;
+	return failures;
+}
+
+// exit code for main(), zero only if every check passed
+inline int testResult()
+{
+	if (checkFailures() > 0)
+	{
+		std::cout << checkFailures() << " checks failed" << std::endl;
+		return 1;
+	}
+
+	std::cout << "all checks passed" << std::endl;
+	return 0;
+}
+
+// ctest reports a test that returns this as skipped, see SKIP_RETURN_CODE in CMakeLists.txt
+const int TEST_SKIPPED = 77;
+
+#define CHECK_TRUE(t_condition) \
+	do { if (!(t_condition)) { std::cout << __FILE__ << ":" << __LINE__ << ": failed " << #t_condition << std::endl; checkFailures()++; } } while (false)
+
+// fails if either value is NaN
+#define CHECK_NEAR(t_actual, t_expected, t_tolerance) \
+	do { const double actual = (t_actual); const double expected = (t_expected); \
+		if (!(std::abs(actual - expected) <= (t_tolerance))) { std::cout << __FILE__ << ":" << __LINE__ << ": " << #t_actual \
+			<< " is " << actual << ", expected " << expected << " within " << (t_tolerance) << std::endl; checkFailures()++; } } while (false)
+
+#endif // !CHECK
@@ -0,0 +1,262 @@
+// Author: Michal K.
+
+#include <cstdio>
+#include "Simulation.h"
+#include "World.h"
+#include "Systems.h"
+#include "AiGunner.h"
+#include "InputRecording.h"
+#include "Check.h"
+
+// the window-free game world in lab4_sim: entities, explosions, recordings and fast forward
+
+namespace
+{
+	const sf::Time TICK = sf::seconds(1.0f / 60.0f); // default tick rate
+	const char * const RECORDING = "simulation_test.rec"; // written to the directory ctest runs in
+
+
+	/// a destroyed entity loses every component and its id is handed out again
+	void testWorldEntities()
+	{
+		World world;
+		const Entity first = world.create();
+		const Entity second = world.create();
+		CHECK_TRUE(first != second);
+
+		world.transforms().add(first, Transform{});
+		world.colliders().add(first, Collider{ Collider::asteroid, 0.0f });
+		world.destroy(first);
+
+		CHECK_TRUE(!world.transforms().has(first));
+		CHECK_TRUE(!world.colliders().has(first));
+		CHECK_TRUE(world.create() == first); // freed id reused before a new one
+
+		const Entity laser = world.spawnLaser(sf::Vector2f{ 400.0f, 500.0f }, sf::Vector2f{ 400.0f, 100.0f }, 60.0f, 200.0f);
+		CHECK_TRUE(laser != NO_ENTITY);
+		CHECK_TRUE(world.laserCount() == 1u);
+		CHECK_NEAR(world.lifetimes().get(laser).stopHeight, 200.0, 0.0); // altitude is reached before the destination
+
+		world.clear();
+		CHECK_TRUE(world.laserCount() == 0u);
+		CHECK_TRUE(world.asteroidCount() == 0u);
+	}
+
+
+	/// an explosion that reaches its max radius during a tick still shoots down what it touches before then
+	/// an asteroid standing at t_distance from the centre of an explosion of radius 29, at the slowest tick rate
+	/// <returns>asteroids shot down</returns>
+	std::size_t lastGrowthHits(float t_distance)
+	{
+		const float seconds = 1.0f / 30.0f; // the explosion grows 2 pixels, to 31, and is gone at 30
+		World world;
+		FrameArena arena;
+		Random random{ 1u };
+		CollisionSystem collisions{ Simulation::WIDTH, Simulation::HEIGHT, Simulation::GROUND_TOP };
+
+		const sf::Vector2f centre{ 400.0f, 300.0f };
+		const Entity laser = world.spawnLaser(centre, centre, 60.0f, 0.0f); // explodes where it starts
+		laserFlightSystem(world, seconds);
+		world.colliders().get(laser).radius = World::MAX_EXPLOSION_RADIUS - 1.0f;
+
+		world.spawnAsteroids(1u, 0.0f, Simulation::WIDTH, Simulation::HEIGHT, random, arena);
+		for (std::size_t i = 0u; i < world.colliders().size(); i++)
+		{
+			if (world.colliders()[i].layer == Collider::asteroid) // stands still next to the explosion
+			{
+				world.transforms().get(world.colliders().entity(i)).tipPoint = centre + sf::Vector2f{ t_distance, 0.0f };
+				world.velocities().get(world.colliders().entity(i)).perSecond = sf::Vector2f{ 0.0f, 0.0f };
+			}
+		}
+
+		// one tick in the order Simulation::update() runs the systems
+		explosionSystem(world, seconds);
+		const CollisionSystem::Result result = collisions.update(world, seconds, arena);
+		finishedExplosionSystem(world);
+
+		CHECK_TRUE(!world.colliders().has(laser)); // finished by the end of the tick
+		return result.shotDown;
+	}
+
+
+	/// the last growth of an explosion is swept like the rest, the part past its max radius is not
+	void testExplosionEnd()
+	{
+		CHECK_TRUE(lastGrowthHits(World::MAX_EXPLOSION_RADIUS - 0.5f) == 1u);
+		CHECK_TRUE(lastGrowthHits(World::MAX_EXPLOSION_RADIUS + 0.5f) == 0u);
+	}
+
+
+	/// a laser stopping halfway through a tick only explodes from then on, at the slowest tick rate
+	/// an asteroid crossing 0.2 pixels from where it stops, just before it stops, slips past the explosion
+	void testMidTickExplosion()
+	{
+		const float seconds = 1.0f / 30.0f; // laser flies 2 pixels a tick, the explosion grows 2
+		World world;
+		FrameArena arena;
+		Random random{ 1u };
+		CollisionSystem collisions{ Simulation::WIDTH, Simulation::HEIGHT, Simulation::GROUND_TOP };
+
+		const sf::Vector2f base{ 400.0f, 300.0f };
+		const Entity laser = world.spawnLaser(base, sf::Vector2f{ 400.0f, 100.0f }, 60.0f, 299.0f); // stops 1 pixel up
+
+		world.spawnAsteroids(1u, 0.0f, Simulation::WIDTH, Simulation::HEIGHT, random, arena);
+		for (std::size_t i = 0u; i < world.colliders().size(); i++)
+		{
+			if (world.colliders()[i].layer == Collider::asteroid) // level with the stop point halfway through the tick
+			{
+				world.transforms().get(world.colliders().entity(i)).tipPoint = sf::Vector2f{ 400.2f, 298.0f };
+				world.velocities().get(world.colliders().entity(i)).perSecond = sf::Vector2f{ 0.0f, 60.0f };
+			}
+		}
+
+		// one tick in the order Simulation::update() runs the systems
+		explosionSystem(world, seconds);
+		laserFlightSystem(world, seconds);
+		CHECK_NEAR(world.colliders().get(laser).bornAt, 0.5, 0.0001);
+		CHECK_NEAR(world.colliders().get(laser).radius, 1.0, 0.0001);
+
+		// grown from nothing since the start of the tick the explosion would have touched it at a third of the tick
+		CHECK_TRUE(collisions.update(world, seconds, arena).shotDown == 0u);
+	}
+
+
+	/// a recorded session replayed with the seed from the file ends in exactly the same state
+	void testReplay()
+	{
+		const std::uint64_t seed = 42u;
+		const unsigned ticks = 30000u; // several games of custom mode
+		Simulation played{ 0u, false, seed };
+		AiGunner gunner{ AiGunner::custom, TICK };
+		InputRecorder recorder;
+		CHECK_TRUE(recorder.open(RECORDING, seed));
+
+		for (unsigned tick = 0u; tick < ticks; tick++)
+		{
+			feedSourceEvents(played, gunner, recorder);
+			played.update(TICK);
+		}
+		recorder = InputRecorder{}; // closes the file
+
+		InputReplay replay;
+		CHECK_TRUE(replay.open(RECORDING));
+		CHECK_TRUE(replay.seed() == seed);
+
+		Simulation replayed{ 0u, false, replay.seed() };
+		InputRecorder notRecording; // never opened
+		for (unsigned tick = 0u; tick < ticks; tick++)
+		{
+			feedSourceEvents(replayed, replay, notRecording);
+			replayed.update(TICK);
+		}
+
+		CHECK_TRUE(gunner.shotsFired() > 0u);
+		CHECK_TRUE(replay.finished());
+		CHECK_TRUE(replayed.tick() == played.tick());
+		CHECK_TRUE(replayed.gameState() == played.gameState());
+		CHECK_TRUE(replayed.score() == played.score());
+		CHECK_TRUE(replayed.playerLvl() == played.playerLvl());
+		CHECK_TRUE(replayed.xp() == played.xp());
+		CHECK_TRUE(replayed.world().asteroidCount() == played.world().asteroidCount());
+		CHECK_TRUE(replayed.world().laserCount() == played.world().laserCount());
+
+		std::remove(RECORDING);
+	}
+
+
+	/// every key a window can report is replayed as itself, Unknown included
+	void testKeyRoundTrip()
+	{
+		const sf::Keyboard::Key keys[] = { sf::Keyboard::Unknown, sf::Keyboard::A, sf::Keyboard::Num2, sf::Keyboard::F3 };
+		InputRecorder recorder;
+		CHECK_TRUE(recorder.open(RECORDING, 1u));
+
+		for (std::uint32_t tick = 0u; tick < 4u; tick++)
+		{
+			sf::Event event{};
+			event.type = sf::Event::KeyPressed;
+			event.key.code = keys[tick];
+			recorder.record(tick, event);
+		}
+		recorder = InputRecorder{}; // closes the file
+
+		InputReplay replay;
+		CHECK_TRUE(replay.open(RECORDING));
+		for (std::uint32_t tick = 0u; tick < 4u; tick++)
+		{
+			sf::Event event{};
+			CHECK_TRUE(replay.nextEvent(tick, event));
+			CHECK_TRUE(event.type == sf::Event::KeyPressed && event.key.code == keys[tick]);
+		}
+		CHECK_TRUE(replay.finished());
+		replay = InputReplay{};
+
+		std::remove(RECORDING);
+	}
+
+
+	/// no one presses space, game over goes straight back to classic mode like a headless run
+	void restartAfterGameOver(Simulation & t_simulation)
+	{
+		if (t_simulation.gameState() == Simulation::gameOver)
+		{
+			t_simulation.setGameState(Simulation::mainMenu);
+		}
+
+		else if (t_simulation.gameState() == Simulation::mainMenu) // main menu has reset the game
+		{
+			t_simulation.setGameState(Simulation::classicMode);
+		}
+	}
+
+
+	/// ticks jumped by fast forward end where ticking them one by one does
+	void testFastForward()
+	{
+		Simulation stepped{ 5u, false, 7u };
+		Simulation skipped{ 5u, false, 7u };
+		unsigned skippedTicks = 0u; // ticks fast forward jumped
+
+		while (skipped.tick() < 20000u) // nobody shoots, every wave reaches the ground
+		{
+			const std::uint32_t skip = skipped.ticksUntilNextEvent(TICK);
+			skipped.skipTicks(skip, TICK);
+			skipped.update(TICK);
+			restartAfterGameOver(skipped);
+			skippedTicks += skip;
+		}
+
+		while (stepped.tick() < skipped.tick())
+		{
+			stepped.update(TICK);
+			restartAfterGameOver(stepped);
+		}
+
+		CHECK_TRUE(skippedTicks > 10000u); // most of the run was jumped
+		CHECK_TRUE(skipped.gameState() == stepped.gameState());
+		CHECK_TRUE(skipped.world().asteroidCount() == stepped.world().asteroidCount());
+
+		const ComponentPool<Transform> & steppedTips = stepped.world().transforms();
+		const ComponentPool<Transform> & skippedTips = skipped.world().transforms();
+		CHECK_TRUE(steppedTips.size() == skippedTips.size());
+		// one long step rounds differently from hundreds of short ones, a fraction of a pixel apart
+		for (std::size_t i = 0u; i < steppedTips.size() && i < skippedTips.size(); i++) // same order, same spawns
+		{
+			CHECK_NEAR(skippedTips[i].tipPoint.x, steppedTips[i].tipPoint.x, 0.5);
+			CHECK_NEAR(skippedTips[i].tipPoint.y, steppedTips[i].tipPoint.y, 0.5);
+		}
+	}
+}
+
+
+int main()
+{
+	testWorldEntities();
+	testExplosionEnd();
+	testMidTickExplosion();
+	testReplay();
+	testKeyRoundTrip();
+	testFastForward();
+
+	return testResult();
+}
@@ -0,0 +1,58 @@
+// Author: Michal K.
+
+#include <cmath>
+#include <iostream>
+#include "Simulation.h"
+#include "SimulationThread.h"
+#include "InputRecording.h"
+#include "Check.h"
+
+// the simulation thread keeps its tick rate however long the render side takes over a frame
+
+namespace
+{
+	const float TICK_RATE = 60.0f; // default tick rate
+	const float TOLERANCE = 0.05f; // fraction of the tick rate a run may be off by, scheduler wake ups included
+
+
+	/// ticks per second while a fake frame takes t_renderDelay, several ticks longer than one tick
+	/// the newest snapshot has to keep up too, the renderer would otherwise draw an old tick
+	void testTickRate(sf::Time t_renderDelay)
+	{
+		const sf::Time duration = sf::seconds(2.0f); // long enough for one late wake up not to matter
+		Simulation simulation{ 1000u, false, 1u }; // big wave so every tick does some work
+		InputRecorder recorder; // never opened
+		SimulationThread simulationThread{ simulation, recorder, nullptr, sf::seconds(1.0f / TICK_RATE) };
+		std::uint32_t lastSnapshot = 0u; // tick of the newest snapshot acquired
+
+		simulation.setGameState(Simulation::classicMode);
+		simulationThread.start();
+
+		sf::Clock clock;
+		while (clock.getElapsedTime() < duration)
+		{
+			if (simulationThread.snapshots().acquire())
+			{
+				lastSnapshot = simulationThread.snapshots().front().tick;
+			}
+			sf::sleep(t_renderDelay); // frame being drawn
+		}
+
+		simulationThread.stop();
+		const float seconds = clock.getElapsedTime().asSeconds(); // whole run, including the last frame
+		const float rate = simulationThread.ticks() / seconds;
+
+		std::cout << "render " << t_renderDelay.asMilliseconds() << " ms per frame: " << rate << " ticks per second" << std::endl;
+		CHECK_NEAR(rate, TICK_RATE, TICK_RATE * TOLERANCE);
+		CHECK_TRUE(simulationThread.ticks() - lastSnapshot <= static_cast<std::uint32_t>(std::ceil(t_renderDelay.asSeconds() * TICK_RATE)) + 1u);
+	}
+}
+
+
+int main()
+{
+	testTickRate(sf::milliseconds(50)); // three ticks a frame
+	testTickRate(sf::milliseconds(200)); // twelve ticks a frame
+
+	return testResult();
+}
@@ -0,0 +1,117 @@
+// Author: Michal K.
+
+#include <algorithm>
+#include <iostream>
+#include "Simulation.h"
+#include "AiGunner.h"
+#include "InputRecording.h"
+#include "Check.h"
+
+// the same game played at 30, 60, 120 and 240 ticks per second ends the same way
+
+namespace
+{
+	const unsigned DECISION_RATE = 30u; // the gunner looks at the game this often at every rate, the slowest rate's ticks
+	const unsigned GAMES = 6u; // games played to the end at every rate
+	const float MAX_SECONDS = 3600.0f; // game time after which a run is given up on, the gunner loses long before
+	const double TIME_TOLERANCE = 0.1; // seconds each game's length may differ by, games end on a tick, see main()
+
+
+	/// asks the AI gunner only on ticks at a multiple of 1/30 s, so at every rate it sees the game at the same moments
+	class ThirtiethGunner : public InputSource
+	{
+	public:
+		ThirtiethGunner(AiGunner::Mode t_mode, unsigned t_rate) :
+			m_gunner{ t_mode, sf::seconds(1.0f / t_rate) },
+			m_stride{ t_rate / DECISION_RATE }
+		{
+		}
+
+		bool nextEvent(const Simulation & t_simulation, sf::Event & t_event) override
+		{
+			return t_simulation.tick() % m_stride == 0u && m_gunner.nextEvent(t_simulation, t_event);
+		}
+
+		const AiGunner & gunner() const { return m_gunner; }
+
+	private:
+		AiGunner m_gunner; // plays the game
+		const std::uint32_t m_stride; // ticks between decisions
+	};
+
+
+	/// how a run ended
+	struct Outcome
+	{
+		unsigned gamesOver = 0u; // transitions into game over
+		long long totalScore = 0; // score of every game
+		int bestLevel = 1; // highest level reached
+		double seconds = 0.0; // game time played, menus do not count
+		double gameSeconds[GAMES] = {}; // length of every game, in the order they were played
+	};
+
+
+	/// GAMES games of t_mode at t_rate ticks per second, seed and gunner the same at every rate
+	Outcome play(AiGunner::Mode t_mode, unsigned t_rate)
+	{
+		const sf::Time timePerTick = sf::seconds(1.0f / t_rate);
+		const std::uint32_t ticks = static_cast<std::uint32_t>(MAX_SECONDS * t_rate);
+		Simulation simulation{ 0u, false, 5u };
+		ThirtiethGunner gunner{ t_mode, t_rate };
+		InputRecorder notRecording; // never opened
+		Outcome outcome;
+		Simulation::m_gameState state = simulation.gameState(); // state after the last tick
+
+		for (std::uint32_t tick = 0u; tick < ticks && outcome.gamesOver < GAMES; tick++)
+		{
+			feedSourceEvents(simulation, gunner, notRecording);
+			simulation.update(timePerTick);
+
+			if (simulation.gameState() == Simulation::gameOver && state != Simulation::gameOver)
+			{
+				outcome.gameSeconds[outcome.gamesOver] = simulation.time() - outcome.seconds; // menus do not count
+				outcome.seconds = simulation.time();
+				outcome.gamesOver++;
+				outcome.totalScore += simulation.score();
+			}
+			outcome.bestLevel = std::max(outcome.bestLevel, simulation.playerLvl());
+			state = simulation.gameState();
+		}
+
+		std::cout << t_rate << " Hz: " << outcome.gamesOver << " games over in " << outcome.seconds << " s, total score "
+			<< outcome.totalScore << ", best level " << outcome.bestLevel << ", " << gunner.gunner().shotsFired() << " shots" << std::endl;
+		return outcome;
+	}
+
+
+	/// every rate against 60 Hz, the default
+	void testMode(AiGunner::Mode t_mode)
+	{
+		const Outcome reference = play(t_mode, 60u);
+		const unsigned rates[] = { 30u, 120u, 240u };
+
+		for (unsigned rate : rates)
+		{
+			const Outcome outcome = play(t_mode, rate);
+			CHECK_TRUE(outcome.gamesOver == GAMES);
+			CHECK_TRUE(outcome.bestLevel == reference.bestLevel);
+			CHECK_TRUE(outcome.totalScore == reference.totalScore);
+			for (unsigned game = 0u; game < GAMES; game++)
+			{
+				CHECK_NEAR(outcome.gameSeconds[game], reference.gameSeconds[game], TIME_TOLERANCE);
+			}
+		}
+	}
+}
+
+
+// waves launch and end, lasers fly and explosions grow the same at every rate, so every rate plays the same games
+// scores and levels must match exactly, a game only ends on the tick its last asteroid lands, a tenth of a second is allowed
+// float rounding still differs between rates, if one compiler turns a grazing shot into a miss loosen this for that compiler
+int main()
+{
+	testMode(AiGunner::custom);
+	testMode(AiGunner::classic);
+
+	return testResult();
+}
@@ -0,0 +1,93 @@
+// Author: Michal K.
+
+#include "VectorFormulas.h"
+#include "Check.h"
+
+// projection, rejection and angle of VectorFormulas.h, in float and double
+
+
+/// projection keeps only the part along the second vector, rejection the rest
+template <typename T>
+void testProjection()
+{
+	const sf::Vector2<T> vector{ T(3), T(4) };
+	const sf::Vector2<T> xAxis{ T(1), T(0) };
+
+	const sf::Vector2<T> projection = vectorProjection(vector, xAxis);
+	CHECK_NEAR(projection.x, 3.0, 1e-6);
+	CHECK_NEAR(projection.y, 0.0, 1e-6);
+
+	// length of the second vector does not matter, only its direction
+	const sf::Vector2<T> longProjection = vectorProjection(vector, sf::Vector2<T>{ T(-5), T(0) });
+	CHECK_NEAR(longProjection.x, 3.0, 1e-6);
+	CHECK_NEAR(longProjection.y, 0.0, 1e-6);
+
+	const sf::Vector2<T> slanted{ T(2), T(-7) }; // not along an axis
+	const sf::Vector2<T> onto{ T(1.5), T(0.5) };
+	const sf::Vector2<T> slantedProjection = vectorProjection(slanted, onto);
+	const sf::Vector2<T> rejection = vectorRejection(slanted, onto);
+
+	CHECK_NEAR(vectorDotProduct(rejection, onto), 0.0, 1e-5); // perpendicular to the second vector
+	CHECK_NEAR(vectorCrossProduct(slantedProjection, onto), 0.0, 1e-5); // parallel to it
+	CHECK_NEAR(slantedProjection.x + rejection.x, slanted.x, 1e-5); // the two parts add back up
+	CHECK_NEAR(slantedProjection.y + rejection.y, slanted.y, 1e-5);
+	CHECK_NEAR(vectorScalarProjection(vector, xAxis), 3.0, 1e-6);
+}
+
+
+/// angle is in degrees, parallel and opposite vectors must not leave the range of acos
+template <typename T>
+void testAngle()
+{
+	const sf::Vector2<T> vector{ T(0.1), T(0.7) }; // cosine with itself rounds above one without the clamp
+	const sf::Vector2<T> opposite{ T(-0.3), T(-2.1) };
+
+	CHECK_NEAR(vectorAngleBetween(vector, vector), 0.0, 1e-3);
+	CHECK_NEAR(vectorAngleBetween(vector, vector * T(3)), 0.0, 1e-3);
+	CHECK_NEAR(vectorAngleBetween(vector, opposite), 180.0, 1e-3);
+	CHECK_NEAR(vectorAngleBetween(sf::Vector2<T>{ T(1), T(0) }, sf::Vector2<T>{ T(0), T(2) }), 90.0, 1e-4);
+
+	for (int i = 1; i < 1000; i++) // many directions, none may give NaN
+	{
+		const sf::Vector2<T> direction{ std::cos(T(i)), std::sin(T(i)) };
+		const T angle = vectorAngleBetween(direction * T(i), direction);
+		CHECK_TRUE(angle == angle);
+		CHECK_NEAR(angle, 0.0, 0.05);
+		CHECK_NEAR(vectorAngleBetween(direction, -direction), 180.0, 0.05);
+	}
+}
+
+
+/// zero vectors give zero, as documented, never NaN or infinity
+template <typename T>
+void testZeroLength()
+{
+	const sf::Vector2<T> zero{ T(0), T(0) };
+	const sf::Vector2<T> vector{ T(3), T(4) };
+
+	CHECK_NEAR(vectorLength(zero), 0.0, 0.0);
+	CHECK_NEAR(vectorUnitVector(zero).x, 0.0, 0.0);
+	CHECK_NEAR(vectorUnitVector(zero).y, 0.0, 0.0);
+	CHECK_NEAR(vectorProjection(vector, zero).x, 0.0, 0.0);
+	CHECK_NEAR(vectorProjection(vector, zero).y, 0.0, 0.0);
+	CHECK_NEAR(vectorRejection(vector, zero).x, 3.0, 0.0); // nothing removed
+	CHECK_NEAR(vectorRejection(vector, zero).y, 4.0, 0.0);
+	CHECK_NEAR(vectorProjection(zero, vector).x, 0.0, 0.0);
+	CHECK_NEAR(vectorScalarProjection(vector, zero), 0.0, 0.0);
+	CHECK_NEAR(vectorAngleBetween(vector, zero), 0.0, 0.0);
+	CHECK_NEAR(vectorAngleBetween(zero, zero), 0.0, 0.0);
+	CHECK_NEAR(vectorLength(vectorUnitVector(vector)), 1.0, 1e-6);
+}
+
+
+int main()
+{
+	testProjection<float>();
+	testProjection<double>();
+	testAngle<float>();
+	testAngle<double>();
+	testZeroLength<float>();
+	testZeroLength<double>();
+
+	return testResult();
+}